@@ -64,6 +64,22 @@ function(rpp_add_library NAME)
 
   target_compile_features(${NAME} INTERFACE cxx_std_20)
 
+  if (${NAME} STREQUAL "rpp" AND RPP_COMPUTATIONAL_USE_WORK_STEALING)
+    target_compile_definitions(${NAME} INTERFACE RPP_COMPUTATIONAL_USE_WORK_STEALING)
+  endif()
+
+  if (${NAME} STREQUAL "rpp" AND RPP_SCHEDULERS_CACHED_NOW)
+    target_compile_definitions(${NAME} INTERFACE RPP_SCHEDULERS_CACHED_NOW)
+  endif()
+
+  if (${NAME} STREQUAL "rpp" AND RPP_SCHEDULERS_COARSE_CLOCK)
+    target_compile_definitions(${NAME} INTERFACE RPP_SCHEDULERS_COARSE_CLOCK)
+  endif()
+
+  if (${NAME} STREQUAL "rpp" AND RPP_ENABLE_INSTRUMENTATION)
+    target_compile_definitions(${NAME} INTERFACE RPP_ENABLE_INSTRUMENTATION)
+  endif()
+
   if (CMAKE_CXX_COMPILER_ID MATCHES "Clang" OR CMAKE_CXX_COMPILER_ID MATCHES "GNU")
     target_compile_options(${NAME} INTERFACE -fsized-deallocation)
   endif()
@@ -84,6 +100,10 @@ option(RPP_BUILD_SFML_CODE "Enable SFML support in examples/code." OFF)
 option(RPP_BUILD_QT_CODE "Enable QT support in examples/code." OFF)
 option(RPP_BUILD_GRPC_CODE "Enable grpc++ support in examples/code." OFF)
 option(RPP_BUILD_ASIO_CODE "Enable ASIO support in examples/code." OFF)
+option(RPP_COMPUTATIONAL_USE_WORK_STEALING "Use work-stealing thread pool for computational scheduler." OFF)
+option(RPP_SCHEDULERS_CACHED_NOW "Schedulers read clock once per batch of schedulables and share this value within batch." OFF)
+option(RPP_SCHEDULERS_COARSE_CLOCK "Schedulers use coarse (low resolution, but cheaper) monotonic clock where available." OFF)
+option(RPP_ENABLE_INSTRUMENTATION "Count allocations and alive internal objects (disposables, dynamic observers, schedulables, subject observers) available via rpp::instrumentation::take_snapshot()." OFF)
 
 if (RPP_DEVELOPER_MODE)
   option(RPP_BUILD_TESTS      "Build unit tests tree." OFF)
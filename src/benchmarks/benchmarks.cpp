@@ -3,13 +3,21 @@
 
 #include <rpp/rpp.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <new>
 #include <span>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
+#include <vector>
 #ifdef RPP_BUILD_RXCPP
     #include <rxcpp/rx.hpp>
 #endif
@@ -21,10 +29,10 @@
     bench.context("benchmark_name", NAME); \
     if (!section.has_value() || std::string_view{NAME}.find(section.value()) != std::string_view::npos)
 #define TEST_RPP(...) \
-    if (!disable_rpp) bench.context("source", "rpp").run(__VA_ARGS__)
+    if (!disable_rpp) bench.context("source", "rpp").context("allocations", count_allocations_per_run(__VA_ARGS__)).context("instrumentation", instrumentation_per_run(__VA_ARGS__)).run(__VA_ARGS__)
 #ifdef RPP_BUILD_RXCPP
     #define TEST_RXCPP(...) \
-        if (!disable_rxcpp) bench.context("source", "rxcpp").run(__VA_ARGS__)
+        if (!disable_rxcpp) bench.context("source", "rxcpp").context("allocations", count_allocations_per_run(__VA_ARGS__)).context("instrumentation", "null").run(__VA_ARGS__)
 #else
     #define TEST_RXCPP(...)
 #endif
@@ -37,12 +45,160 @@ char const * json() noexcept
             "name": "{{context(benchmark_name)}}",
             "source" : "{{context(source)}}",
             "median(elapsed)": {{median(elapsed)}},
-            "medianAbsolutePercentError(elapsed)": {{medianAbsolutePercentError(elapsed)}}
+            "medianAbsolutePercentError(elapsed)": {{medianAbsolutePercentError(elapsed)}},
+            "allocations": {{context(allocations)}},
+            "latency": {{context(latency)}},
+            "allocated_bytes": {{context(allocated_bytes)}},
+            "instrumentation": {{context(instrumentation)}}
         }{{^-last}},{{/-last}}
 {{/result}}
 ])DELIM";
 }
 
+namespace
+{
+    thread_local size_t s_allocations_count{};
+    thread_local size_t s_allocated_bytes{};
+
+    /**
+     * @brief Average amount of heap allocations done by one run of `fn` after warming up (to skip lazily allocated caches and pools)
+     */
+    template<typename Fn>
+    std::string count_allocations_per_run(Fn&& fn)
+    {
+        constexpr size_t warmup_runs = 3;
+        constexpr size_t runs        = 10;
+
+        for (size_t i = 0; i < warmup_runs; ++i)
+            fn();
+
+        const auto before = s_allocations_count;
+        for (size_t i = 0; i < runs; ++i)
+            fn();
+
+        return std::to_string(static_cast<double>(s_allocations_count - before) / runs);
+    }
+
+    /**
+     * @brief Average amount of bytes allocated from heap by one run of `fn` after warming up. Useful to track memory cost of subscription
+     */
+    template<typename Fn>
+    std::string count_allocated_bytes_per_run(Fn&& fn)
+    {
+        constexpr size_t warmup_runs = 3;
+        constexpr size_t runs        = 10;
+
+        for (size_t i = 0; i < warmup_runs; ++i)
+            fn();
+
+        const auto before = s_allocated_bytes;
+        for (size_t i = 0; i < runs; ++i)
+            fn();
+
+        return std::to_string(static_cast<double>(s_allocated_bytes - before) / runs);
+    }
+
+    /**
+     * @brief Per category of `rpp::instrumentation`: average amount of allocations done by one run of `fn` and amount of objects/bytes left alive after it (non-zero means leak or cache) as JSON object. `null` if instrumentation is disabled
+     */
+    template<typename Fn>
+    std::string instrumentation_per_run(Fn&& fn)
+    {
+        if constexpr (!rpp::instrumentation::is_enabled)
+            return "null";
+
+        constexpr size_t warmup_runs = 3;
+        constexpr size_t runs        = 10;
+
+        for (size_t i = 0; i < warmup_runs; ++i)
+            fn();
+
+        const auto before = rpp::instrumentation::take_snapshot();
+        for (size_t i = 0; i < runs; ++i)
+            fn();
+        const auto after = rpp::instrumentation::take_snapshot();
+
+        const auto per_run = [&](size_t after_value, size_t before_value) {
+            return std::to_string((static_cast<double>(after_value) - static_cast<double>(before_value)) / runs);
+        };
+
+        std::string result = "{";
+        for (size_t i = 0; i < rpp::instrumentation::categories_count; ++i)
+        {
+            const auto category = static_cast<rpp::instrumentation::category>(i);
+            result += (i == 0 ? R"(")" : R"(, ")") + std::string{rpp::instrumentation::to_string(category)} + R"(": {"allocations": )" + per_run(after[category].allocations, before[category].allocations)
+                    + R"(, "reused": )" + per_run(after[category].reused, before[category].reused)
+                    + R"(, "alive": )" + per_run(after[category].alive, before[category].alive)
+                    + R"(, "alive_bytes": )" + per_run(after[category].alive_bytes, before[category].alive_bytes) + "}";
+        }
+        return result + "}";
+    }
+
+    /**
+     * @brief Median and 99th percentile (in ns) of duration of single run of `fn` as JSON object
+     */
+    template<typename Fn>
+    std::string measure_latency_percentiles(Fn&& fn)
+    {
+        constexpr size_t runs = 10'000;
+
+        std::vector<std::chrono::nanoseconds> samples{};
+        samples.reserve(runs);
+        for (size_t i = 0; i < runs; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            fn();
+            samples.push_back(std::chrono::steady_clock::now() - start);
+        }
+        std::sort(samples.begin(), samples.end());
+
+        return R"({"p50": )" + std::to_string(samples[runs / 2].count()) + R"(, "p99": )" + std::to_string(samples[runs * 99 / 100].count()) + "}";
+    }
+
+    /**
+     * @brief Applies `Count` trivial `map` operators to observable
+     */
+    template<size_t Count>
+    auto apply_maps(auto&& observable)
+    {
+        if constexpr (Count == 0)
+            return std::forward<decltype(observable)>(observable);
+        else
+            return apply_maps<Count - 1>(std::forward<decltype(observable)>(observable) | rpp::operators::map([](int v) { return v + 1; }));
+    }
+
+    /**
+     * @brief Applies `Count` trivial `map` operators to observable and erases its type to `dynamic_observable` after each of them
+     */
+    template<size_t Count>
+    auto apply_dynamic_maps(auto&& observable)
+    {
+        if constexpr (Count == 0)
+            return std::forward<decltype(observable)>(observable);
+        else
+            return apply_dynamic_maps<Count - 1>((std::forward<decltype(observable)>(observable) | rpp::operators::map([](int v) { return v + 1; })).as_dynamic());
+    }
+} // namespace
+
+void* operator new(size_t size)
+{
+    ++s_allocations_count;
+    s_allocated_bytes += size;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
 std::optional<std::string_view> find_argument(std::string_view target_argument, std::span<char*> args)
 {
     for (const auto raw_argument : args)
@@ -76,7 +232,7 @@ namespace rxcpp
 
 int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
 {
-    auto       bench         = ankerl::nanobench::Bench{}.output(nullptr).warmup(3);
+    auto       bench         = ankerl::nanobench::Bench{}.output(nullptr).warmup(3).context("latency", "null").context("allocated_bytes", "null").context("instrumentation", "null");
     const auto args          = std::span{argv, static_cast<size_t>(argc)};
     const auto benchmark     = find_argument("--benchmark=", args);
     const auto section       = find_argument("--section=", args);
@@ -119,6 +275,78 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int) {});
             });
         }
+
+        SECTION("Subscribe empty callbacks to empty dynamic observable")
+        {
+            TEST_RPP([&]() {
+                rpp::source::create<int>([&](auto&& observer) {
+                    ankerl::nanobench::doNotOptimizeAway(observer);
+                })
+                    .as_dynamic()
+                    .subscribe([](int) {});
+            });
+
+            TEST_RXCPP([&]() {
+                rxcpp::observable<>::create<int>([&](auto&& observer) {
+                    ankerl::nanobench::doNotOptimizeAway(observer);
+                })
+                    .as_dynamic()
+                    .subscribe([](int) {});
+            });
+        }
+
+        SECTION("as_dynamic observer + on_next")
+        {
+            TEST_RPP([&]() {
+                const auto observer = rpp::make_lambda_observer<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }).as_dynamic();
+                observer.on_next(1);
+            });
+        }
+
+        const auto measure_subscription_memory = [&](const auto& subscribe) {
+            bench.context("allocated_bytes", count_allocated_bytes_per_run(subscribe));
+            TEST_RPP(subscribe);
+            bench.context("allocated_bytes", "null");
+        };
+
+        SECTION("composite_disposable with 1 dependency: make + add + dispose")
+        {
+            measure_subscription_memory([&]() {
+                const auto d = rpp::composite_disposable_wrapper::make();
+                d.add(rpp::composite_disposable_wrapper::make());
+                d.dispose();
+            });
+        }
+
+        SECTION("composite_disposable with 3 dependencies: make + add + dispose")
+        {
+            measure_subscription_memory([&]() {
+                const auto d = rpp::composite_disposable_wrapper::make();
+                for (size_t i = 0; i < 3; ++i)
+                    d.add(rpp::composite_disposable_wrapper::make());
+                d.dispose();
+            });
+        }
+
+        SECTION("disposable_wrapper make + as_weak + lock + dispose")
+        {
+            TEST_RPP([&]() {
+                const auto d    = rpp::composite_disposable_wrapper::make();
+                const auto weak = d.as_weak();
+                weak.lock()->dispose();
+                ankerl::nanobench::doNotOptimizeAway(d.is_disposed());
+            });
+        }
+        SECTION("Subscribe with disposable to never observable + merge_with + take_until")
+        {
+            measure_subscription_memory([&]() {
+                const auto d = rpp::source::never<int>()
+                             | rpp::operators::merge_with(rpp::source::never<int>())
+                             | rpp::operators::take_until(rpp::source::never<int>())
+                             | rpp::operators::subscribe_with_disposable([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                d.dispose();
+            });
+        }
     }; // BENCHMARK("General")
 
     BENCHMARK("Sources")
@@ -230,6 +458,26 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
 
     BENCHMARK("Schedulers")
     {
+        SECTION("details::now()")
+        {
+            TEST_RPP([&]() {
+                ankerl::nanobench::doNotOptimizeAway(rpp::schedulers::details::now());
+            });
+        }
+        SECTION("details::now() inside cached_now_scope")
+        {
+            const rpp::schedulers::details::cached_now_scope scope{};
+            TEST_RPP([&]() {
+                ankerl::nanobench::doNotOptimizeAway(rpp::schedulers::details::now());
+            });
+        }
+        SECTION("details::coarse_now()")
+        {
+            TEST_RPP([&]() {
+                ankerl::nanobench::doNotOptimizeAway(rpp::schedulers::details::coarse_now());
+            });
+        }
+
         SECTION("immediate scheduler create worker + schedule")
         {
             TEST_RPP([&]() {
@@ -278,6 +526,316 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     });
                 });
         }
+
+        SECTION("current_thread scheduler just(1,2,3) + subscribe with owned queue")
+        {
+            // schedulables go through the queue and should be served from already allocated memory in steady state
+            TEST_RPP([&]() {
+                const auto guard = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
+                rpp::source::just(1, 2, 3).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+            TEST_RXCPP([&]() {
+                rxcpp::observable<>::from(rxcpp::identity_current_thread(), 1, 2, 3).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        const auto queue_emplace_pop = [&](size_t pending, const auto& get_timepoint) {
+            rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{};
+
+            const auto obs = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            const auto fn  = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+
+            size_t index{};
+            for (; index < pending; ++index)
+                queue.emplace(get_timepoint(index), fn, obs);
+
+            TEST_RPP([&]() {
+                queue.emplace(get_timepoint(index++), fn, obs);
+                ankerl::nanobench::doNotOptimizeAway(queue.pop());
+            });
+        };
+
+        const auto monotonic_timepoint = [](size_t index) { return rpp::schedulers::time_point{std::chrono::nanoseconds{index}}; };
+        const auto random_timepoint    = [](size_t index) { return rpp::schedulers::time_point{std::chrono::nanoseconds{index + (index * 7919) % 100'000}}; };
+
+        SECTION("schedulables_queue emplace + pop with 10 pending monotonic schedulables")
+        {
+            queue_emplace_pop(10, monotonic_timepoint);
+        }
+        SECTION("schedulables_queue emplace + pop with 1000 pending monotonic schedulables")
+        {
+            queue_emplace_pop(1'000, monotonic_timepoint);
+        }
+        SECTION("schedulables_queue emplace + pop with 100000 pending monotonic schedulables")
+        {
+            queue_emplace_pop(100'000, monotonic_timepoint);
+        }
+        SECTION("schedulables_queue emplace + pop with 10 pending random schedulables")
+        {
+            queue_emplace_pop(10, random_timepoint);
+        }
+        SECTION("schedulables_queue emplace + pop with 1000 pending random schedulables")
+        {
+            queue_emplace_pop(1'000, random_timepoint);
+        }
+        SECTION("schedulables_queue emplace + pop with 100000 pending random schedulables")
+        {
+            queue_emplace_pop(100'000, random_timepoint);
+        }
+
+        SECTION("schedulables_queue emplace + pop with 9 of 10 schedulables cancelled before due time")
+        {
+            rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{};
+
+            const auto alive_obs = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            const auto fn        = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+
+            size_t index{};
+            TEST_RPP([&]() {
+                // like `timeout`: each timer is scheduled far ahead and cancelled by next emission long before its time_point
+                const auto d = rpp::composite_disposable_wrapper::make();
+                for (size_t i = 0; i < 9; ++i)
+                    queue.emplace(rpp::schedulers::time_point{std::chrono::seconds{1} + std::chrono::nanoseconds{index++}}, fn, rpp::make_lambda_observer(d, [](int) {}));
+                d.dispose();
+
+                queue.emplace(rpp::schedulers::time_point{std::chrono::nanoseconds{index++}}, fn, alive_obs);
+                ankerl::nanobench::doNotOptimizeAway(queue.pop());
+            });
+            ankerl::nanobench::doNotOptimizeAway(queue.size());
+        }
+
+        SECTION("new_thread worker: 8 producer threads schedule 1000 schedulables each")
+        {
+            const auto obs = rpp::make_lambda_observer([](int) {}).as_dynamic();
+
+            TEST_RPP([&]() {
+                const auto worker = rpp::schedulers::new_thread::create_worker();
+
+                std::atomic_size_t       remaining{8 * 1000};
+                std::vector<std::thread> producers{};
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    producers.emplace_back([&] {
+                        for (size_t j = 0; j < 1000; ++j)
+                        {
+                            worker.schedule([&remaining](const auto&) {
+                                --remaining;
+                                return rpp::schedulers::optional_delay_from_now{};
+                            },
+                                            obs);
+                        }
+                    });
+                }
+                for (auto& producer : producers)
+                    producer.join();
+
+                while (remaining.load() != 0)
+                    std::this_thread::yield();
+            });
+        }
+
+        SECTION("8 x from array of 1000 + subscribe_on(new_thread) + merge + observe_on(new_thread) + as_blocking + subscribe")
+        {
+            const auto vals   = std::vector<int>(1000, 1);
+            const auto source = rpp::source::from_iterable(vals) | rpp::ops::subscribe_on(rpp::schedulers::new_thread{});
+
+            TEST_RPP([&]() {
+                (rpp::source::just(rpp::schedulers::immediate{}, source, source, source, source, source, source, source, source)
+                 | rpp::ops::merge()
+                 | rpp::ops::observe_on(rpp::schedulers::new_thread{})
+                 | rpp::ops::as_blocking())
+                    .subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        const auto new_thread_burst = [&](size_t max_batch_size) {
+            const auto obs    = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            const auto worker = rpp::schedulers::new_thread::create_worker(max_batch_size);
+
+            TEST_RPP([&]() {
+                std::atomic_size_t remaining{1000};
+                for (size_t i = 0; i < 1000; ++i)
+                {
+                    worker.schedule([&remaining](const auto&) {
+                        remaining.fetch_sub(1, std::memory_order_release);
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                    obs);
+                }
+                while (remaining.load(std::memory_order_acquire) != 0)
+                    std::this_thread::yield();
+            });
+        };
+
+        SECTION("new_thread worker with batch size 1: burst of 1000 schedulables")
+        {
+            new_thread_burst(1);
+        }
+        SECTION("new_thread worker with default batch size: burst of 1000 schedulables")
+        {
+            new_thread_burst(rpp::schedulers::new_thread::s_default_max_batch_size);
+        }
+
+        const auto run_loop_burst = [&](size_t max_batch_size) {
+            const auto obs      = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            const auto loop   = rpp::schedulers::run_loop{max_batch_size};
+            const auto worker = loop.create_worker();
+
+            TEST_RPP([&]() {
+                for (size_t i = 0; i < 1000; ++i)
+                    worker.schedule([](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+                while (loop.is_any_ready_schedulable())
+                    loop.dispatch_if_ready();
+            });
+        };
+
+        SECTION("run_loop with batch size 1: dispatch burst of 1000 schedulables")
+        {
+            run_loop_burst(1);
+        }
+        SECTION("run_loop with batch size 64: dispatch burst of 1000 schedulables")
+        {
+            run_loop_burst(64);
+        }
+
+        const auto bursty_observe_on = [&](size_t bursts, size_t burst_size) {
+            rpp::subjects::publish_subject<int> subj{};
+            std::atomic_size_t                  received{};
+
+            const auto d = subj.get_observable()
+                         | rpp::ops::observe_on(rpp::schedulers::new_thread{})
+                         | rpp::ops::subscribe_with_disposable([&received](int) { received.fetch_add(1, std::memory_order_release); });
+
+            const auto observer = subj.get_observer();
+            size_t     expected{};
+
+            TEST_RPP([&]() {
+                for (size_t i = 0; i < bursts; ++i)
+                {
+                    for (size_t j = 0; j < burst_size; ++j)
+                        observer.on_next(1);
+
+                    expected += burst_size;
+                    while (received.load(std::memory_order_acquire) != expected)
+                        std::this_thread::yield();
+                }
+            });
+            d.dispose();
+        };
+
+        SECTION("publish_subject + observe_on(new_thread): latency of single value")
+        {
+            bursty_observe_on(1, 1);
+        }
+        SECTION("publish_subject + observe_on(new_thread): 10 bursts of 100 values")
+        {
+            bursty_observe_on(10, 100);
+        }
+
+        const auto ping_pong = [&](rpp::schedulers::idle_strategy idle) {
+            rpp::subjects::publish_subject<int> subj{};
+            std::atomic_size_t                  received{};
+
+            const auto d = subj.get_observable()
+                         | rpp::ops::observe_on(rpp::schedulers::configured_new_thread{idle})
+                         | rpp::ops::observe_on(rpp::schedulers::configured_new_thread{idle})
+                         | rpp::ops::subscribe_with_disposable([&received](int) { received.fetch_add(1, std::memory_order_release); });
+
+            const auto observer = subj.get_observer();
+            size_t     expected{};
+
+            const auto round_trip = [&]() {
+                observer.on_next(1);
+                ++expected;
+                while (received.load(std::memory_order_acquire) != expected)
+                    std::this_thread::yield();
+            };
+
+            bench.context("latency", measure_latency_percentiles(round_trip));
+            TEST_RPP(round_trip);
+            bench.context("latency", "null");
+            d.dispose();
+        };
+
+        SECTION("ping-pong via 2 x observe_on(new_thread) parking when idle")
+        {
+            ping_pong(rpp::schedulers::idle_strategy{});
+        }
+        SECTION("ping-pong via 2 x observe_on(new_thread) spinning 10000 + yielding 100 when idle")
+        {
+            ping_pong(rpp::schedulers::idle_strategy{.spin_count = 10'000, .yield_count = 100});
+        }
+
+        const auto spread_timers = [&](rpp::schedulers::duration timer_slack) {
+            const auto scheduler = rpp::schedulers::thread_pool{rpp::schedulers::thread_pool_options{.threads_count = 1, .timer_slack = timer_slack}};
+            const auto obs       = rpp::make_lambda_observer([](int) {}).as_dynamic();
+
+            std::vector<decltype(scheduler.create_worker())> workers{};
+            for (size_t i = 0; i < 100; ++i)
+                workers.push_back(scheduler.create_worker());
+
+            TEST_RPP([&]() {
+                std::atomic_size_t remaining{1000};
+                for (size_t i = 0; i < 1000; ++i)
+                {
+                    workers[i % workers.size()].schedule(std::chrono::microseconds{(i * 7919) % 10'000}, [&remaining](const auto&) {
+                        remaining.fetch_sub(1, std::memory_order_release);
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                                         obs);
+                }
+                while (remaining.load(std::memory_order_acquire) != 0)
+                    std::this_thread::yield();
+            });
+        };
+
+        SECTION("thread_pool with 1 thread: 1000 timers spread over 10ms")
+        {
+            spread_timers(rpp::schedulers::duration{});
+        }
+        SECTION("thread_pool with 1 thread and 2ms timer slack: 1000 timers spread over 10ms")
+        {
+            spread_timers(std::chrono::milliseconds{2});
+        }
+
+        const auto skewed_load = [&](const auto& scheduler) {
+            // 4 workers over 2 threads, but only 1st and 3rd workers are loaded: round-robin places them to the same thread
+            std::vector<decltype(scheduler.create_worker())> workers{};
+            for (size_t i = 0; i < 4; ++i)
+                workers.push_back(scheduler.create_worker());
+
+            const auto obs = rpp::make_lambda_observer([](int) {}).as_dynamic();
+
+            TEST_RPP([&]() {
+                std::atomic_size_t remaining{200};
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    for (const size_t index : {0, 2})
+                    {
+                        workers[index].schedule([&remaining](const auto&) {
+                            size_t sum{};
+                            for (size_t v = 0; v < 1000; ++v)
+                                ankerl::nanobench::doNotOptimizeAway(sum += v);
+                            --remaining;
+                            return rpp::schedulers::optional_delay_from_now{};
+                        },
+                                                obs);
+                    }
+                }
+                while (remaining.load() != 0)
+                    std::this_thread::yield();
+            });
+        };
+
+        SECTION("thread_pool with 2 threads: 200 tasks for 2 of 4 workers")
+        {
+            skewed_load(rpp::schedulers::thread_pool{2});
+        }
+        SECTION("work_stealing_thread_pool with 2 threads: 200 tasks for 2 of 4 workers")
+        {
+            skewed_load(rpp::schedulers::work_stealing_thread_pool{2});
+        }
     } // BENCHMARK("Schedulers")
 
     BENCHMARK("Combining Operators")
@@ -472,6 +1030,20 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<rxcpp::observable<int>>([](const rxcpp::observable<int>& v) { v.subscribe([](int vv) { ankerl::nanobench::doNotOptimizeAway(vv); }); });
             });
         }
+        SECTION("immediate_just(1,2,3,4,5,6,7,8,9,10)+window(1)+subscribe + subscsribe inner")
+        {
+            TEST_RPP([&]() {
+                rpp::immediate_just(1, 2, 3, 4, 5, 6, 7, 8, 9, 10)
+                    | rpp::operators::window(1)
+                    | rpp::operators::subscribe([](const auto& v) { v.subscribe([](int vv) { ankerl::nanobench::doNotOptimizeAway(vv); }); });
+            });
+
+            TEST_RXCPP([&]() {
+                rxcpp::immediate_just(1, 2, 3, 4, 5, 6, 7, 8, 9, 10)
+                    | rxcpp::operators::window(1)
+                    | rxcpp::operators::subscribe<rxcpp::observable<int>>([](const rxcpp::observable<int>& v) { v.subscribe([](int vv) { ankerl::nanobench::doNotOptimizeAway(vv); }); });
+            });
+        }
     }; // BENCHMARK("Transforming Operators")
 
     BENCHMARK("Filtering Operators")
@@ -713,23 +1285,88 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                 s.get_subscriber().on_next(1);
             });
         }
-        SECTION("100 on_next to 100 observers to publish_subject")
+        SECTION("subscribe + dispose of 1 observer with disposable to existing publish_subject")
         {
             {
                 rpp::subjects::publish_subject<int> rpp_subj{};
-                for (size_t i = 0; i < 100; ++i)
-                {
-                    rpp_subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
-                }
                 TEST_RPP([&] {
-                    for (size_t i = 0; i < 100; ++i)
-                        rpp_subj.get_observer().on_next(i);
+                    const auto d = rpp::composite_disposable_wrapper::make();
+                    rpp_subj.get_observable().subscribe(d, [](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                    d.dispose();
+                });
+            }
+            {
+                rxcpp::subjects::subject<int> rxcpp_subj{};
+                TEST_RXCPP([&] {
+                    rxcpp_subj.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }).unsubscribe();
                 });
             }
+        }
+        SECTION("subscribe + dispose of 1 observer with disposable to existing publish_subject with 1000 observers")
+        {
+            {
+                rpp::subjects::publish_subject<int> rpp_subj{};
+                for (size_t i = 0; i < 1000; ++i)
+                    rpp_subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
 
+                TEST_RPP([&] {
+                    const auto d = rpp::composite_disposable_wrapper::make();
+                    rpp_subj.get_observable().subscribe(d, [](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                    d.dispose();
+                });
+            }
             {
                 rxcpp::subjects::subject<int> rxcpp_subj{};
+                for (size_t i = 0; i < 1000; ++i)
+                    rxcpp_subj.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                TEST_RXCPP([&] {
+                    rxcpp_subj.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }).unsubscribe();
+                });
+            }
+        }
+        SECTION("subscribe 10000 observers with disposables to publish_subject + dispose them in order of subscription")
+        {
+            TEST_RPP([&] {
+                rpp::subjects::publish_subject<int>            s{};
+                std::vector<rpp::composite_disposable_wrapper> disposables{};
+                disposables.reserve(10000);
+                for (size_t i = 0; i < 10000; ++i)
+                {
+                    disposables.push_back(rpp::composite_disposable_wrapper::make());
+                    s.get_observable().subscribe(disposables.back(), [](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                }
+                for (const auto& d : disposables)
+                    d.dispose();
+            });
+            TEST_RXCPP([&] {
+                rxcpp::subjects::subject<int>           s{};
+                std::vector<rxcpp::composite_subscription> subscriptions{};
+                subscriptions.reserve(10000);
+                for (size_t i = 0; i < 10000; ++i)
+                    subscriptions.push_back(s.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+                for (const auto& d : subscriptions)
+                    d.unsubscribe();
+            });
+        }
+
+        const auto rpp_on_next_to_observers = [&](auto rpp_subj, size_t observers_count) {
+            for (size_t i = 0; i < observers_count; ++i)
+            {
+                rpp_subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+            }
+            TEST_RPP([&] {
                 for (size_t i = 0; i < 100; ++i)
+                    rpp_subj.get_observer().on_next(static_cast<int>(i));
+            });
+        };
+
+        const auto on_next_to_observers = [&](size_t observers_count) {
+            rpp_on_next_to_observers(rpp::subjects::publish_subject<int>{}, observers_count);
+
+            {
+                rxcpp::subjects::subject<int> rxcpp_subj{};
+                for (size_t i = 0; i < observers_count; ++i)
                 {
                     rxcpp_subj.get_observable().subscribe(rxcpp::make_subscriber<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
                 }
@@ -738,6 +1375,149 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                         rxcpp_subj.get_subscriber().on_next(i);
                 });
             }
+        };
+
+        SECTION("100 on_next to 1 observer to publish_subject")
+        {
+            on_next_to_observers(1);
+        }
+        SECTION("100 on_next to 10 observers to publish_subject")
+        {
+            on_next_to_observers(10);
+        }
+        SECTION("100 on_next to 100 observers to publish_subject")
+        {
+            on_next_to_observers(100);
+        }
+        SECTION("100 on_next to 1000 observers to publish_subject")
+        {
+            on_next_to_observers(1000);
+        }
+        SECTION("100 on_next to 10000 observers to publish_subject")
+        {
+            on_next_to_observers(10000);
+        }
+        SECTION("100 on_next to 100000 observers to publish_subject")
+        {
+            on_next_to_observers(100000);
+        }
+        SECTION("100 on_next to 10 observers to behavior_subject")
+        {
+            rpp_on_next_to_observers(rpp::subjects::behavior_subject<int>{0}, 10);
+        }
+        SECTION("100 on_next to 1000 observers to behavior_subject")
+        {
+            rpp_on_next_to_observers(rpp::subjects::behavior_subject<int>{0}, 1000);
+        }
+        SECTION("100 on_next to 100000 observers to behavior_subject")
+        {
+            rpp_on_next_to_observers(rpp::subjects::behavior_subject<int>{0}, 100000);
+        }
+        const auto on_next_to_slow_observers = [&](auto rpp_subj, size_t observers_count) {
+            std::atomic<size_t> delivered{};
+            for (size_t i = 0; i < observers_count; ++i)
+            {
+                rpp_subj.get_observable().subscribe([&delivered](int v) {
+                    for (int j = 0; j < 100; ++j)
+                        ankerl::nanobench::doNotOptimizeAway(v + j);
+                    delivered.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+
+            size_t expected{};
+            TEST_RPP([&] {
+                for (size_t i = 0; i < 100; ++i)
+                    rpp_subj.get_observer().on_next(static_cast<int>(i));
+
+                // sharded subject delivers values asynchronously, so wait till all observers obtain them
+                expected += 100 * observers_count;
+                while (delivered.load(std::memory_order_relaxed) != expected)
+                    std::this_thread::yield();
+            });
+            rpp_subj.get_disposable().dispose();
+        };
+
+        SECTION("100 on_next to 10 slow observers to publish_subject")
+        {
+            on_next_to_slow_observers(rpp::subjects::publish_subject<int>{}, 10);
+        }
+        SECTION("100 on_next to 10 slow observers to sharded_publish_subject")
+        {
+            on_next_to_slow_observers(rpp::subjects::sharded_publish_subject<int, rpp::schedulers::thread_pool>{rpp::schedulers::thread_pool{}}, 10);
+        }
+        SECTION("100 on_next to 1000 slow observers to publish_subject")
+        {
+            on_next_to_slow_observers(rpp::subjects::publish_subject<int>{}, 1000);
+        }
+        SECTION("100 on_next to 1000 slow observers to sharded_publish_subject")
+        {
+            on_next_to_slow_observers(rpp::subjects::sharded_publish_subject<int, rpp::schedulers::thread_pool>{rpp::schedulers::thread_pool{}}, 1000);
+        }
+        SECTION("100 on_next to 5000 slow observers to publish_subject")
+        {
+            on_next_to_slow_observers(rpp::subjects::publish_subject<int>{}, 5000);
+        }
+        SECTION("100 on_next to 5000 slow observers to sharded_publish_subject")
+        {
+            on_next_to_slow_observers(rpp::subjects::sharded_publish_subject<int, rpp::schedulers::thread_pool>{rpp::schedulers::thread_pool{}}, 5000);
+        }
+        SECTION("100 on_next to 10 observers to replay_subject(100)")
+        {
+            rpp_on_next_to_observers(rpp::subjects::replay_subject<int>{100}, 10);
+        }
+        SECTION("100 on_next to 10 observers to replay_subject(100, 1s)")
+        {
+            rpp_on_next_to_observers(rpp::subjects::replay_subject<int>{100, std::chrono::seconds{1}}, 10);
+        }
+        SECTION("subscribe + dispose to replay_subject with 10000 values")
+        {
+            rpp::subjects::replay_subject<int> rpp_subj{};
+            for (int i = 0; i < 10000; ++i)
+                rpp_subj.get_observer().on_next(i);
+
+            TEST_RPP([&] {
+                const auto d = rpp::composite_disposable_wrapper::make();
+                rpp_subj.get_observable().subscribe(d, [](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                d.dispose();
+            });
+        }
+        SECTION("subscribe + dispose to replay_subject(1000) of strings")
+        {
+            rpp::subjects::replay_subject<std::string> rpp_subj{1000};
+            for (int i = 0; i < 10000; ++i)
+                rpp_subj.get_observer().on_next(std::string(64, static_cast<char>('a' + i % 26)));
+
+            TEST_RPP([&] {
+                const auto d = rpp::composite_disposable_wrapper::make();
+                rpp_subj.get_observable().subscribe(d, [](const std::string& v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                d.dispose();
+            });
+        }
+        SECTION("100 on_next to 100 observers to publish_subject with concurrent subscribe + dispose")
+        {
+            rpp::subjects::publish_subject<int> rpp_subj{};
+            for (size_t i = 0; i < 100; ++i)
+            {
+                rpp_subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+            }
+
+            std::atomic_bool stop{};
+            std::thread      churn{[&] {
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    const auto d = rpp::composite_disposable_wrapper::make();
+                    rpp_subj.get_observable().subscribe(d, [](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                    d.dispose();
+                }
+            }};
+
+            TEST_RPP([&] {
+                for (size_t i = 0; i < 100; ++i)
+                    rpp_subj.get_observer().on_next(i);
+            });
+
+            stop.store(true, std::memory_order_relaxed);
+            churn.join();
         }
     } // BENCHMARK("Subjects")
 
@@ -777,6 +1557,70 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<char>([](char v) { ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+
+        const auto long_chain = [&](auto&& chain) {
+            const auto source = rpp::source::create<int>([](const auto& obs) {
+                for (int i = 0; i < 1000 && !obs.is_disposed(); ++i)
+                    obs.on_next(i);
+                obs.on_completed();
+            });
+
+            TEST_RPP([&]() {
+                chain(source).subscribe(rpp::composite_disposable_wrapper::make(), [](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        };
+
+        SECTION("1000 values over chain of 1 map + subscribe with disposable")
+        {
+            long_chain([](const auto& source) { return apply_maps<1>(source); });
+        }
+        SECTION("1000 values over chain of 10 maps + subscribe with disposable")
+        {
+            long_chain([](const auto& source) { return apply_maps<10>(source); });
+        }
+        SECTION("1000 values over chain of 50 maps + subscribe with disposable")
+        {
+            long_chain([](const auto& source) { return apply_maps<50>(source); });
+        }
+        SECTION("1000 values over chain of 10 maps (static) + subscribe with disposable")
+        {
+            long_chain([](const auto& source) { return apply_maps<10>(source); });
+        }
+        SECTION("1000 values over chain of 10 maps (dynamic_observable after each) + subscribe with disposable")
+        {
+            long_chain([](const auto& source) { return apply_dynamic_maps<10>(source); });
+        }
+        SECTION("Subscribe to chain of 10 maps (static)")
+        {
+            const auto observable = apply_maps<10>(rpp::source::create<int>([](const auto& obs) { ankerl::nanobench::doNotOptimizeAway(obs); }));
+            TEST_RPP([&]() {
+                observable.subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("Subscribe to chain of 10 maps (dynamic_observable after each)")
+        {
+            const auto observable = apply_dynamic_maps<10>(rpp::source::create<int>([](const auto& obs) { ankerl::nanobench::doNotOptimizeAway(obs); }));
+            TEST_RPP([&]() {
+                observable.subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("1000 subjects + merge + subscribe, subjects completed one by one")
+        {
+            TEST_RPP([&]() {
+                std::vector<rpp::subjects::publish_subject<int>> subjects(1000);
+
+                rpp::source::from_iterable(subjects)
+                    | rpp::operators::map([](const auto& subj) { return subj.get_observable(); })
+                    | rpp::operators::merge()
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                for (const auto& subj : subjects)
+                {
+                    subj.get_observer().on_next(1);
+                    subj.get_observer().on_completed();
+                }
+            });
+        }
     } // BENCHMARK("Scenarios")
 
     if (dump.has_value())
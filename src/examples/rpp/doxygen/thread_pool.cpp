@@ -1,4 +1,5 @@
 #include <rpp/rpp.hpp>
+#include <rpp/schedulers/numa.hpp>
 
 #include <iostream>
 
@@ -8,6 +9,17 @@
 
 int main() // NOLINT(bugprone-exception-escape)
 {
+    //! [thread_pool_options]
+    // pool of `computational` is created on first usage, so it should be configured before
+    rpp::schedulers::computational::configure(rpp::schedulers::thread_pool_options{.threads_count = 4, .name = "computational"});
+
+    // each thread of pool is pinned to its own core: "pinned-0" to CPU 0, "pinned-1" to CPU 1
+    const auto pinned_scheduler = rpp::schedulers::thread_pool{rpp::schedulers::thread_pool_options{.threads_count = 2, .name = "pinned", .affinity = {{0}, {1}}}};
+
+    // all threads of pool are allowed to run only on CPUs of first NUMA node
+    const auto numa_scheduler = rpp::schedulers::work_stealing_thread_pool{rpp::schedulers::thread_pool_options{.threads_count = 2, .affinity = {rpp::schedulers::utils::get_numa_node_cpus(0)}}};
+    //! [thread_pool_options]
+
     //! [thread_pool]
     const auto scheduler = rpp::schedulers::thread_pool{4};
     rpp::source::just(1, 2, 3, 4, 5, 6, 7, 8)
@@ -45,5 +57,24 @@ int main() // NOLINT(bugprone-exception-escape)
     // [thread_4] 8
     //! [computational]
 
+    //! [work_stealing_thread_pool]
+    const auto work_stealing_scheduler = rpp::schedulers::work_stealing_thread_pool{4};
+    rpp::source::just(1, 2, 3, 4, 5, 6, 7, 8)
+        | rpp::operators::flat_map([work_stealing_scheduler](int value) { return rpp::source::just(work_stealing_scheduler, value)
+                                                                               | rpp::operators::delay(std::chrono::nanoseconds{500}, rpp::schedulers::immediate{}); })
+        | rpp::operators::as_blocking()
+        | rpp::operators::subscribe([](int v) { std::cout << "[" << std::this_thread::get_id() << "] " << v << std::endl; });
+
+    // Output: (can be in any order and any thread of pool can process any value)
+    // [thread_3] 1
+    // [thread_1] 2
+    // [thread_3] 3
+    // [thread_2] 4
+    // [thread_4] 5
+    // [thread_1] 6
+    // [thread_2] 7
+    // [thread_4] 8
+    //! [work_stealing_thread_pool]
+
     return 0;
 }
@@ -115,7 +115,7 @@ namespace rppasio::schedulers
                 {
                     while (!m_queue.is_empty())
                     {
-                        const auto top = m_queue.pop();
+                        const std::shared_ptr<rpp::schedulers::details::schedulable_base> top = m_queue.pop();
                         if (top->is_disposed())
                             continue;
 
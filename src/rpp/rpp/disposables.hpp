@@ -21,6 +21,7 @@
 
 #include <rpp/disposables/callback_disposable.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_ptr.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/interface_composite_disposable.hpp>
 #include <rpp/disposables/interface_disposable.hpp>
@@ -37,27 +37,26 @@ namespace rpp
         bool is_disposed() const noexcept final
         {
             // just need atomicity, not guarding anything
-            return m_current_state.load(std::memory_order::seq_cst) == State::Disposed;
+            return m_current_state.load(std::memory_order::relaxed) == State::Disposed;
         }
 
         void dispose_impl(interface_disposable::Mode mode) noexcept final
         {
-            while (true)
+            State expected{State::None};
+            // need to acquire possible state changing from `add`
+            while (!m_current_state.compare_exchange_strong(expected, State::Disposed, std::memory_order::acquire, std::memory_order::relaxed))
             {
-                State expected{State::None};
-                // need to acquire possible state changing from `add`
-                if (m_current_state.compare_exchange_strong(expected, State::Disposed, std::memory_order::seq_cst))
-                {
-                    composite_dispose_impl(mode);
-
-                    m_disposables.dispose();
-                    m_disposables.clear();
-                    return;
-                }
-
                 if (expected == State::Disposed)
                     return;
+
+                wait_for_edit_end(expected);
+                expected = State::None;
             }
+
+            composite_dispose_impl(mode);
+
+            m_disposables.dispose();
+            m_disposables.clear();
         }
 
         using interface_composite_disposable::add;
@@ -67,87 +66,42 @@ namespace rpp
             if (disposable.is_disposed() || disposable.lock().get() == this)
                 return;
 
-            while (true)
-            {
-                State expected{State::None};
-                // need to acquire possible disposables state changing from other `add`
-                if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::seq_cst))
-                {
-                    try
-                    {
-                        m_disposables.push_back(std::move(disposable));
-                    }
-                    catch (...)
-                    {
-                        m_current_state.store(State::None, std::memory_order::seq_cst);
-                        throw;
-                    }
-                    // need to propogate disposables state changing to others
-                    m_current_state.store(State::None, std::memory_order::seq_cst);
-                    return;
-                }
+            if (!edit([&] { m_disposables.push_back(std::move(disposable)); }))
+                disposable.dispose();
+        }
 
-                if (expected == State::Disposed)
-                {
-                    disposable.dispose();
-                    return;
-                }
-            }
+        /**
+         * @brief Same as `add`, but returns handle which can be used to remove disposable in O(1) via `remove(handle)`
+         */
+        details::disposables::disposable_handle add_with_handle(disposable_wrapper disposable)
+            requires details::disposables::constraint::disposable_container_with_handles<Container>
+        {
+            details::disposables::disposable_handle handle{};
+            if (disposable.is_disposed() || disposable.lock().get() == this)
+                return handle;
+
+            if (!edit([&] { handle = m_disposables.push_back_with_handle(std::move(disposable)); }))
+                disposable.dispose();
+            return handle;
         }
 
         void remove(const disposable_wrapper& disposable) override
         {
-            while (true)
-            {
-                State expected{State::None};
-                // need to acquire possible disposables state changing from other `add` or `remove`
-                if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::seq_cst))
-                {
-                    try
-                    {
-                        m_disposables.remove(disposable);
-                    }
-                    catch (...)
-                    {
-                        m_current_state.store(State::None, std::memory_order::seq_cst);
-                        throw;
-                    }
-                    // need to propogate disposables state changing to others
-                    m_current_state.store(State::None, std::memory_order::seq_cst);
-                    return;
-                }
+            edit([&] { m_disposables.remove(disposable); });
+        }
 
-                if (expected == State::Disposed)
-                    return;
-            }
+        void remove(const details::disposables::disposable_handle& handle)
+            requires details::disposables::constraint::disposable_container_with_handles<Container>
+        {
+            edit([&] { m_disposables.remove(handle); });
         }
 
         void clear() override
         {
-            while (true)
-            {
-                State expected{State::None};
-                // need to acquire possible disposables state changing from other `add` or `remove`
-                if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::seq_cst))
-                {
-                    try
-                    {
-                        m_disposables.dispose();
-                        m_disposables.clear();
-                    }
-                    catch (...)
-                    {
-                        m_current_state.store(State::None, std::memory_order::seq_cst);
-                        throw;
-                    }
-                    // need to propogate disposables state changing to others
-                    m_current_state.store(State::None, std::memory_order::seq_cst);
-                    return;
-                }
-
-                if (expected == State::Disposed)
-                    return;
-            }
+            edit([&] {
+                m_disposables.dispose();
+                m_disposables.clear();
+            });
         }
 
     protected:
@@ -156,11 +110,61 @@ namespace rpp
     private:
         enum class State : uint8_t
         {
-            None,    // default state
-            Edit,    // set it during adding new element into deps or removing. After success -> back to None
-            Disposed // permanent state after dispose
+            None,            // default state
+            Edit,            // set it during adding new element into deps or removing. After success -> back to None
+            EditWithWaiters, // same as Edit, but some thread waits for end of edit and needs to be notified
+            Disposed         // permanent state after dispose
         };
 
+        /**
+         * @brief Executes `fn` with exclusive access to container
+         * @return false if disposable is disposed, so `fn` was not executed
+         */
+        template<std::invocable Fn>
+        bool edit(Fn&& fn)
+        {
+            State expected{State::None};
+            // need to acquire possible disposables state changing from other `add` or `remove`
+            while (!m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::acquire, std::memory_order::relaxed))
+            {
+                if (expected == State::Disposed)
+                    return false;
+
+                wait_for_edit_end(expected);
+                expected = State::None;
+            }
+
+            try
+            {
+                fn();
+            }
+            catch (...)
+            {
+                finish_edit();
+                throw;
+            }
+            finish_edit();
+            return true;
+        }
+
+        void finish_edit()
+        {
+            // need to propogate disposables state changing to others
+            // notify only if someone waits: uncontended add/remove should not pay for it
+            if (m_current_state.exchange(State::None, std::memory_order::release) == State::EditWithWaiters)
+                m_current_state.notify_all();
+        }
+
+        void wait_for_edit_end(State current)
+        {
+            // state changed meanwhile (edit is finished), so just retry
+            if (current == State::Edit && !m_current_state.compare_exchange_strong(current, State::EditWithWaiters, std::memory_order::relaxed, std::memory_order::relaxed))
+                return;
+
+            // block instead of spinning while other thread edits container: it could take a while (allocation of memory, disposing in `clear`)
+            m_current_state.wait(State::EditWithWaiters, std::memory_order::relaxed);
+        }
+
         Container          m_disposables{};
         std::atomic<State> m_current_state{};
     };
@@ -175,3 +179,11 @@ namespace rpp
     {
     };
 } // namespace rpp
+
+namespace rpp::details
+{
+    /**
+     * @brief Composite disposable with O(1) removal of dependencies by handles obtained from `add_with_handle`.
+     */
+    using slots_composite_disposable = composite_disposable_impl<disposables::slots_disposables_container>;
+} // namespace rpp::details
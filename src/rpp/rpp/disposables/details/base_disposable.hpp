@@ -29,14 +29,14 @@ namespace rpp::details
         bool is_disposed() const noexcept final
         {
             // just need atomicity, not guarding anything
-            return m_disposed.load(std::memory_order::seq_cst);
+            return m_disposed.load(std::memory_order::relaxed);
         }
 
     private:
         void dispose_impl(interface_disposable::Mode mode) noexcept final
         {
-            // just need atomicity, not guarding anything
-            if (m_disposed.exchange(true, std::memory_order::seq_cst) == false)
+            // just need atomicity (exactly one caller wins), not guarding anything
+            if (m_disposed.exchange(true, std::memory_order::relaxed) == false)
                 base_dispose_impl(mode);
         }
 
@@ -13,60 +13,11 @@
 #include <rpp/utils/exceptions.hpp>
 
 #include <algorithm>
+#include <optional>
 #include <vector>
 
 namespace rpp::details::disposables
 {
-    class dynamic_disposables_container_base
-    {
-    public:
-        explicit dynamic_disposables_container_base(size_t count)
-        {
-            m_data.reserve(count);
-        }
-
-        void push_back(const rpp::disposable_wrapper& d)
-        {
-            m_data.push_back(d);
-        }
-
-        void push_back(rpp::disposable_wrapper&& d)
-        {
-            m_data.push_back(std::move(d));
-        }
-
-        void remove(const rpp::disposable_wrapper& d)
-        {
-            m_data.erase(std::remove(m_data.begin(), m_data.end(), d), m_data.end());
-        }
-
-        void dispose() const
-        {
-            for (const auto& d : m_data)
-            {
-                d.dispose();
-            }
-        }
-
-        void clear()
-        {
-            m_data.clear();
-        }
-
-    private:
-        mutable std::vector<rpp::disposable_wrapper> m_data{};
-    };
-
-    template<size_t Count>
-    class dynamic_disposables_container : public dynamic_disposables_container_base
-    {
-    public:
-        dynamic_disposables_container()
-            : dynamic_disposables_container_base{Count}
-        {
-        }
-    };
-
     template<size_t Count>
     class static_disposables_container
     {
@@ -80,6 +31,7 @@ namespace rpp::details::disposables
             if (this == &other)
                 return *this;
 
+            clear();
             m_size = other.m_size;
             for (size_t i = 0; i < m_size; ++i)
                 std::construct_at(get(i), std::move(*other.get(i)));
@@ -144,6 +96,8 @@ namespace rpp::details::disposables
             m_size = 0;
         }
 
+        size_t size() const { return m_size; }
+
     private:
         const rpp::disposable_wrapper* get(size_t i) const
         {
@@ -159,6 +113,169 @@ namespace rpp::details::disposables
         size_t m_size{};
     };
 
+    /**
+     * @brief Container with inline storage for first `InlineCount` disposables and spilling to heap only for the rest. Most of composites keep 1-3 dependencies, so in most cases there is no any extra allocation at all.
+     */
+    template<size_t InlineCount>
+    class small_disposables_container
+    {
+    public:
+        small_disposables_container() = default;
+
+        explicit small_disposables_container(size_t count)
+        {
+            if (count > InlineCount)
+                m_overflow.reserve(count - InlineCount);
+        }
+
+        void push_back(const rpp::disposable_wrapper& d)
+        {
+            if (m_inline.size() < InlineCount)
+                m_inline.push_back(d);
+            else
+                m_overflow.push_back(d);
+        }
+
+        void push_back(rpp::disposable_wrapper&& d)
+        {
+            if (m_inline.size() < InlineCount)
+                m_inline.push_back(std::move(d));
+            else
+                m_overflow.push_back(std::move(d));
+        }
+
+        void remove(const rpp::disposable_wrapper& d)
+        {
+            m_inline.remove(d);
+            m_overflow.erase(std::remove(m_overflow.begin(), m_overflow.end(), d), m_overflow.end());
+        }
+
+        void dispose() const
+        {
+            m_inline.dispose();
+            for (const auto& d : m_overflow)
+            {
+                d.dispose();
+            }
+        }
+
+        void clear()
+        {
+            m_inline.clear();
+            m_overflow.clear();
+        }
+
+    private:
+        static_disposables_container<InlineCount> m_inline{};
+        std::vector<rpp::disposable_wrapper>      m_overflow{};
+    };
+
+    /**
+     * @brief Amount of disposables stored inline by `dynamic_disposables_container` for expected amount of disposables. Unknown (zero) expected amount means "a few", big ones are limited to not bloat observers.
+     */
+    consteval size_t get_inline_disposables_count(size_t expected_count)
+    {
+        constexpr size_t default_count = 2;
+        constexpr size_t max_count     = 4;
+        return expected_count == 0 ? default_count : std::min(expected_count, max_count);
+    }
+
+    template<size_t Count>
+    class dynamic_disposables_container : public small_disposables_container<get_inline_disposables_count(Count)>
+    {
+    public:
+        dynamic_disposables_container()
+            : small_disposables_container<get_inline_disposables_count(Count)>{Count}
+        {
+        }
+    };
+
+    /**
+     * @brief Container of slots with O(1) addition and O(1) removal by handle. Freed slots are re-used for next disposables.
+     * @details Intended for composites where dependencies are added and removed frequently while composite is alive (like inner observables of `merge`/`flat_map` or references of `refcount_disposable`), so removal doesn't depend on amount of alive dependencies.
+     */
+    class slots_disposables_container
+    {
+    public:
+        void push_back(const rpp::disposable_wrapper& d)
+        {
+            static_cast<void>(push_back_with_handle(d));
+        }
+
+        void push_back(rpp::disposable_wrapper&& d)
+        {
+            static_cast<void>(push_back_with_handle(std::move(d)));
+        }
+
+        disposable_handle push_back_with_handle(rpp::disposable_wrapper d)
+        {
+            if (m_free_slots.empty())
+            {
+                m_slots.push_back(slot{std::move(d)});
+                return {m_slots.size() - 1, m_slots.back().generation};
+            }
+
+            const auto index = m_free_slots.back();
+            m_free_slots.pop_back();
+
+            auto& slot = m_slots[index];
+            slot.value.emplace(std::move(d));
+            return {index, slot.generation};
+        }
+
+        void remove(const disposable_handle& handle)
+        {
+            if (handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation)
+                free_slot(handle.index);
+        }
+
+        void remove(const rpp::disposable_wrapper& d)
+        {
+            for (size_t i = 0; i < m_slots.size(); ++i)
+            {
+                if (m_slots[i].value == d)
+                    free_slot(i);
+            }
+        }
+
+        void dispose() const
+        {
+            for (const auto& slot : m_slots)
+            {
+                if (slot.value)
+                    slot.value->dispose();
+            }
+        }
+
+        void clear()
+        {
+            // keep slots and their generations to not confuse handles obtained before
+            for (size_t i = 0; i < m_slots.size(); ++i)
+                free_slot(i);
+        }
+
+    private:
+        void free_slot(size_t index)
+        {
+            auto& slot = m_slots[index];
+            if (!slot.value)
+                return;
+
+            slot.value.reset();
+            ++slot.generation;
+            m_free_slots.push_back(index);
+        }
+
+        struct slot
+        {
+            std::optional<rpp::disposable_wrapper> value{};
+            size_t                                 generation{};
+        };
+
+        std::vector<slot>   m_slots{};
+        std::vector<size_t> m_free_slots{};
+    };
+
     struct none_disposables_container
     {
         [[noreturn]] static void push_back(const rpp::disposable_wrapper&)
@@ -0,0 +1,238 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/disposables/fwd.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace rpp::details
+{
+    /**
+     * @brief Reference counters of disposable created via `disposable_wrapper_impl::make`.
+     * @details Disposable is placed right inside of derived class (`auto_dispose_wrapper`), so whole thing is single allocation and strong/weak reference is just pair of raw pointers without any separate control block.
+     * Disposable is destroyed when last strong reference is released, memory is freed when last weak reference is released (all strong references together hold one weak reference).
+     */
+    class disposable_control_block
+    {
+    public:
+        disposable_control_block(const disposable_control_block&)     = delete;
+        disposable_control_block(disposable_control_block&&) noexcept = delete;
+
+        void add_ref() noexcept
+        {
+            // just need atomicity: new reference is created from existing one
+            m_strong.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        /**
+         * @brief Add strong reference only if disposable is still alive (at least one strong reference exists). Used to "lock" weak references.
+         */
+        bool try_add_ref() noexcept
+        {
+            auto count = m_strong.load(std::memory_order::relaxed);
+            while (count != 0)
+            {
+                if (m_strong.compare_exchange_weak(count, count + 1, std::memory_order::relaxed, std::memory_order::relaxed))
+                    return true;
+            }
+            return false;
+        }
+
+        void release_ref() noexcept
+        {
+            // release own usages of disposable before last reference destroys it, last reference acquires all of them
+            if (m_strong.fetch_sub(1, std::memory_order::acq_rel) == 1)
+            {
+                destroy();
+                release_weak_ref();
+            }
+        }
+
+        void add_weak_ref() noexcept
+        {
+            m_weak.fetch_add(1, std::memory_order::relaxed);
+        }
+
+        void release_weak_ref() noexcept
+        {
+            if (m_weak.fetch_sub(1, std::memory_order::acq_rel) == 1)
+                deallocate();
+        }
+
+        size_t use_count() const noexcept
+        {
+            return m_strong.load(std::memory_order::relaxed);
+        }
+
+    protected:
+        disposable_control_block()                   = default;
+        virtual ~disposable_control_block() noexcept = default;
+
+        /**
+         * @brief Creates control block without any references. Used for blocks re-used many times via `reset_refs`.
+         */
+        explicit disposable_control_block(std::nullptr_t) noexcept
+            : m_strong{0}
+            , m_weak{0}
+        {
+        }
+
+        /**
+         * @brief Start new lifetime of block after previous one was ended by `deallocate`: one strong and one weak reference as for new block
+         */
+        void reset_refs() noexcept
+        {
+            m_weak.store(1, std::memory_order::relaxed);
+            // publish disposable constructed before for anyone obtaining reference via `try_add_ref`
+            m_strong.store(1, std::memory_order::release);
+        }
+
+        /**
+         * @brief Destroy disposable (but keep memory) after last strong reference is released
+         */
+        virtual void destroy() noexcept = 0;
+
+        /**
+         * @brief Free memory after last weak reference is released
+         */
+        virtual void deallocate() noexcept { delete this; }
+
+    private:
+        std::atomic<size_t> m_strong{1};
+        std::atomic<size_t> m_weak{1};
+    };
+
+    class disposable_wrapper_base;
+} // namespace rpp::details
+
+namespace rpp
+{
+    /**
+     * @brief Owning pointer to disposable created via `rpp::disposable_wrapper_impl::make`, returned from `rpp::disposable_wrapper_impl::lock`. Same as `std::shared_ptr`, but reference counters are stored inside of the disposable itself, so there is no separate control block.
+     * @details Implicitly converts to `std::shared_ptr` for code expecting it.
+     *
+     * @ingroup disposables
+     */
+    template<typename T>
+    class disposable_ptr
+    {
+    public:
+        template<typename U>
+        friend class disposable_ptr;
+
+        friend class details::disposable_wrapper_base;
+
+        template<typename U, typename V>
+        friend disposable_ptr<U> static_pointer_cast(disposable_ptr<V>&& ptr) noexcept;
+
+        disposable_ptr() = default;
+
+        disposable_ptr(std::nullptr_t) noexcept {}
+
+        disposable_ptr(const disposable_ptr& other) noexcept
+            : m_ptr{other.m_ptr}
+            , m_block{other.m_block}
+        {
+            if (m_block)
+                m_block->add_ref();
+        }
+
+        disposable_ptr(disposable_ptr&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+            , m_block{std::exchange(other.m_block, nullptr)}
+        {
+        }
+
+        template<typename U>
+            requires std::convertible_to<U*, T*>
+        disposable_ptr(const disposable_ptr<U>& other) noexcept
+            : m_ptr{other.m_ptr}
+            , m_block{other.m_block}
+        {
+            if (m_block)
+                m_block->add_ref();
+        }
+
+        template<typename U>
+            requires std::convertible_to<U*, T*>
+        disposable_ptr(disposable_ptr<U>&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+            , m_block{std::exchange(other.m_block, nullptr)}
+        {
+        }
+
+        disposable_ptr& operator=(disposable_ptr other) noexcept
+        {
+            std::swap(m_ptr, other.m_ptr);
+            std::swap(m_block, other.m_block);
+            return *this;
+        }
+
+        ~disposable_ptr() noexcept
+        {
+            if (m_block)
+                m_block->release_ref();
+        }
+
+        void reset() noexcept { *this = disposable_ptr{}; }
+
+        T* get() const noexcept { return m_ptr; }
+        T* operator->() const noexcept { return m_ptr; }
+        T& operator*() const noexcept { return *m_ptr; }
+
+        explicit operator bool() const noexcept { return m_ptr != nullptr; }
+
+        size_t use_count() const noexcept { return m_block ? m_block->use_count() : 0; }
+
+        bool operator==(const disposable_ptr& other) const noexcept { return m_ptr == other.m_ptr; }
+        bool operator==(std::nullptr_t) const noexcept { return m_ptr == nullptr; }
+
+        /**
+         * @brief Shares ownership with `std::shared_ptr`. Costs allocation of control block of `std::shared_ptr`, so prefer `disposable_ptr` itself when possible.
+         */
+        template<typename U>
+            requires std::convertible_to<T*, U*>
+        operator std::shared_ptr<U>() const
+        {
+            if (!m_ptr)
+                return {};
+            return std::shared_ptr<U>{m_ptr, [owner = *this](U*) noexcept { static_cast<void>(owner); }};
+        }
+
+    private:
+        // adopts already counted strong reference
+        disposable_ptr(T* ptr, details::disposable_control_block* block) noexcept
+            : m_ptr{ptr}
+            , m_block{block}
+        {
+        }
+
+        T*                                 m_ptr{};
+        details::disposable_control_block* m_block{};
+    };
+
+    template<typename U, typename V>
+    disposable_ptr<U> static_pointer_cast(disposable_ptr<V>&& ptr) noexcept
+    {
+        return disposable_ptr<U>{static_cast<U*>(std::exchange(ptr.m_ptr, nullptr)), std::exchange(ptr.m_block, nullptr)};
+    }
+
+    template<typename U, typename V>
+    disposable_ptr<U> static_pointer_cast(const disposable_ptr<V>& ptr) noexcept
+    {
+        return static_pointer_cast<U>(disposable_ptr<V>{ptr});
+    }
+} // namespace rpp
@@ -13,11 +13,13 @@
 #include <rpp/disposables/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/disposable_ptr.hpp>
 #include <rpp/disposables/interface_disposable.hpp>
+#include <rpp/instrumentation.hpp>
 #include <rpp/utils/utils.hpp>
 
-#include <memory>
-#include <variant>
+#include <tuple>
+#include <utility>
 
 namespace rpp::details
 {
@@ -25,7 +27,7 @@ namespace rpp::details
     class enable_wrapper_from_this;
 
     template<rpp::constraint::decayed_type TDisposable>
-    class auto_dispose_wrapper final
+    class auto_dispose_wrapper final : public disposable_control_block
     {
     public:
         static_assert(std::derived_from<TDisposable, interface_disposable>);
@@ -35,32 +37,73 @@ namespace rpp::details
         explicit auto_dispose_wrapper(TArgs&&... args)
             : m_data{std::forward<TArgs>(args)...}
         {
+            instrumentation::on_allocated(instrumentation::category::disposables, sizeof(auto_dispose_wrapper));
         }
 
-        auto_dispose_wrapper(const auto_dispose_wrapper&)     = delete;
-        auto_dispose_wrapper(auto_dispose_wrapper&&) noexcept = delete;
-
-        ~auto_dispose_wrapper() noexcept
+        // m_data is destroyed in `destroy` after last strong reference
+        ~auto_dispose_wrapper() noexcept override
         {
-            static_cast<interface_disposable&>(m_data).dispose_impl(rpp::interface_disposable::Mode::Destroying);
+            instrumentation::on_deallocated(instrumentation::category::disposables, sizeof(auto_dispose_wrapper));
         }
 
         TDisposable* get() { return &m_data; }
 
     private:
-        RPP_NO_UNIQUE_ADDRESS TDisposable m_data;
+        void destroy() noexcept override
+        {
+            static_cast<interface_disposable&>(m_data).dispose_impl(rpp::interface_disposable::Mode::Destroying);
+            m_data.~TDisposable();
+        }
+
+        union
+        {
+            TDisposable m_data;
+        };
     };
 
     class disposable_wrapper_base
     {
     public:
+        disposable_wrapper_base(const disposable_wrapper_base& other) noexcept
+            : m_ptr{other.m_ptr}
+            , m_block{other.m_block}
+            , m_is_weak{other.m_is_weak}
+        {
+            add_ref();
+        }
+
+        disposable_wrapper_base(disposable_wrapper_base&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+            , m_block{std::exchange(other.m_block, nullptr)}
+            , m_is_weak{other.m_is_weak}
+        {
+        }
+
+        disposable_wrapper_base& operator=(disposable_wrapper_base other) noexcept
+        {
+            std::swap(m_ptr, other.m_ptr);
+            std::swap(m_block, other.m_block);
+            std::swap(m_is_weak, other.m_is_weak);
+            return *this;
+        }
+
+        ~disposable_wrapper_base() noexcept
+        {
+            release_ref();
+        }
+
         bool operator==(const disposable_wrapper_base& other) const
         {
-            return get().first == other.get().first;
+            // memory of disposable is kept while any wrapper references it, so there is no need to lock anything to compare
+            return m_ptr == other.m_ptr;
         }
 
         bool is_disposed() const noexcept
         {
+            // hot path: observers check it for each emission, so avoid touching of reference counters when wrapper owns disposable
+            if (!m_is_weak)
+                return !m_ptr || m_ptr->is_disposed();
+
             if (const auto locked = get().first)
                 return locked->is_disposed();
             return true;
@@ -68,36 +111,93 @@ namespace rpp::details
 
         void dispose() const noexcept
         {
-            if (const auto locked = get().first)
+            if (!m_is_weak)
+            {
+                if (m_ptr)
+                    m_ptr->dispose();
+            }
+            else if (const auto locked = get().first)
                 locked->dispose();
         }
 
     protected:
-        explicit disposable_wrapper_base(std::shared_ptr<interface_disposable>&& disposable)
-            : m_disposable{std::move(disposable)}
+        // adopts already counted reference
+        disposable_wrapper_base(interface_disposable* ptr, disposable_control_block* block, bool is_weak) noexcept
+            : m_ptr{ptr}
+            , m_block{block}
+            , m_is_weak{is_weak}
         {
         }
 
-        explicit disposable_wrapper_base(std::weak_ptr<interface_disposable>&& disposable)
-            : m_disposable{std::move(disposable)}
+        disposable_wrapper_base() = default;
+
+        std::pair<disposable_ptr<interface_disposable>, bool> get() const noexcept
         {
-        }
+            if (!m_is_weak)
+            {
+                if (m_block)
+                    m_block->add_ref();
+                return {disposable_ptr<interface_disposable>{m_ptr, m_block}, true};
+            }
 
-        disposable_wrapper_base() = default;
+            if (m_block && m_block->try_add_ref())
+                return {disposable_ptr<interface_disposable>{m_ptr, m_block}, false};
+            return {nullptr, false};
+        }
 
-        std::pair<std::shared_ptr<interface_disposable>, bool> get() const noexcept
+        disposable_ptr<interface_disposable> take() && noexcept
         {
-            if (const auto ptr_ptr = std::get_if<std::shared_ptr<interface_disposable>>(&m_disposable))
-                return {*ptr_ptr, true};
+            if (m_is_weak)
+                return get().first;
 
-            if (const auto ptr_ptr = std::get_if<std::weak_ptr<interface_disposable>>(&m_disposable))
-                return {ptr_ptr->lock(), false};
+            const auto [ptr, block, is_weak] = std::move(*this).release();
+            return disposable_ptr<interface_disposable>{ptr, block};
+        }
 
-            return {nullptr, true};
+        /**
+         * @brief Pass ownership of reference to caller without changing of reference counters
+         */
+        std::tuple<interface_disposable*, disposable_control_block*, bool> release() && noexcept
+        {
+            return {std::exchange(m_ptr, nullptr), std::exchange(m_block, nullptr), m_is_weak};
+        }
+
+        /**
+         * @brief Same as `release`, but for new weak reference to the same disposable
+         */
+        std::tuple<interface_disposable*, disposable_control_block*, bool> acquire_weak_ref() const noexcept
+        {
+            if (m_block)
+                m_block->add_weak_ref();
+            return {m_ptr, m_block, true};
         }
 
     private:
-        std::variant<std::monostate, std::shared_ptr<interface_disposable>, std::weak_ptr<interface_disposable>> m_disposable;
+        void add_ref() const noexcept
+        {
+            if (!m_block)
+                return;
+
+            if (m_is_weak)
+                m_block->add_weak_ref();
+            else
+                m_block->add_ref();
+        }
+
+        void release_ref() const noexcept
+        {
+            if (!m_block)
+                return;
+
+            if (m_is_weak)
+                m_block->release_weak_ref();
+            else
+                m_block->release_ref();
+        }
+
+        interface_disposable*     m_ptr{};
+        disposable_control_block* m_block{};
+        bool                      m_is_weak{};
     };
 
 } // namespace rpp::details
@@ -106,8 +206,9 @@ namespace rpp
 {
     /**
      * @brief Wrapper to keep disposable. Any disposable have to be created right from this wrapper with help of `make` function.
-     * @details Member functions is safe to call even if internal disposable is gone. Also  it provides access to "raw" shared_ptr and it can be nullptr in case of disposable empty/ptr gone.
-     * @details Can keep weak_ptr in case of not owning disposable
+     * @details Member functions is safe to call even if internal disposable is gone. Also  it provides access to "raw" owning pointer and it can be nullptr in case of disposable empty/ptr gone.
+     * @details Can keep weak reference in case of not owning disposable
+     * @details Reference counters are placed in the same allocation as disposable itself, so copying/locking of wrapper touches only them without any separate control block
      *
      * @ingroup disposables
      */
@@ -132,13 +233,12 @@ namespace rpp
             requires (std::constructible_from<TTarget, TArgs && ...>)
         [[nodiscard]] static disposable_wrapper_impl make(TArgs&&... args)
         {
-            const auto ptr      = std::make_shared<details::auto_dispose_wrapper<TTarget>>(std::forward<TArgs>(args)...);
-            auto       base_ptr = std::shared_ptr<TDisposable>{ptr, static_cast<TDisposable*>(ptr->get())};
-            if constexpr (rpp::utils::is_base_of_v<TDisposable, rpp::details::enable_wrapper_from_this>)
+            const auto block = new details::auto_dispose_wrapper<TTarget>(std::forward<TArgs>(args)...);
+            if constexpr (rpp::utils::is_base_of_v<TTarget, rpp::details::enable_wrapper_from_this>)
             {
-                base_ptr->set_weak_self(std::weak_ptr<interface_disposable>(base_ptr));
+                block->get()->set_control_block(block);
             }
-            return disposable_wrapper_impl{std::static_pointer_cast<interface_disposable>(std::move(base_ptr))};
+            return disposable_wrapper_impl{static_cast<interface_disposable*>(static_cast<TDisposable*>(block->get())), block, false};
         }
 
         /**
@@ -174,6 +274,26 @@ namespace rpp
                 locked->remove(other);
         }
 
+        /**
+         * @brief Same as `add`, but returns handle to remove disposable in O(1) via `remove(handle)`. Available only for composites supporting handles.
+         */
+        details::disposables::disposable_handle add_with_handle(disposable_wrapper other) const
+            requires requires(TDisposable& d) { d.add_with_handle(std::move(other)); }
+        {
+            if (const auto locked = lock())
+                return locked->add_with_handle(std::move(other));
+
+            other.dispose();
+            return {};
+        }
+
+        void remove(const details::disposables::disposable_handle& handle) const
+            requires requires(TDisposable& d) { d.remove(handle); }
+        {
+            if (const auto locked = lock())
+                locked->remove(handle);
+        }
+
         void clear() const
             requires std::derived_from<TDisposable, interface_composite_disposable>
         {
@@ -181,36 +301,49 @@ namespace rpp
                 locked->clear();
         }
 
-        [[nodiscard]] std::shared_ptr<TDisposable> lock() const noexcept
+        [[nodiscard]] disposable_ptr<TDisposable> lock() const& noexcept
+        {
+            return rpp::static_pointer_cast<TDisposable>(get().first);
+        }
+
+        /**
+         * @brief Same as `lock`, but moves owned reference out of temporary wrapper instead of acquiring new one
+         */
+        [[nodiscard]] disposable_ptr<TDisposable> lock() && noexcept
         {
-            return std::static_pointer_cast<TDisposable>(get().first);
+            return rpp::static_pointer_cast<TDisposable>(std::move(*this).take());
         }
 
         [[nodiscard]] disposable_wrapper_impl as_weak() const
         {
-            auto [locked, is_shared] = get();
-            if (is_shared)
-                return disposable_wrapper_impl{std::weak_ptr<interface_disposable>{locked}};
-            return *this;
+            const auto [ptr, block, is_weak] = acquire_weak_ref();
+            return disposable_wrapper_impl{ptr, block, is_weak};
         }
 
         template<constraint::decayed_type TTarget>
             requires rpp::constraint::static_pointer_convertible_to<TDisposable, TTarget>
-        operator disposable_wrapper_impl<TTarget>() const
+        operator disposable_wrapper_impl<TTarget>() const&
         {
-            auto [locked, is_shared] = get();
-            if (!locked)
-                return rpp::disposable_wrapper_impl<TTarget>::empty();
-
-            auto res = disposable_wrapper_impl<TTarget>{std::move(locked)};
-            if (is_shared)
-                return res;
+            return disposable_wrapper_impl{*this}.template convert_to<TTarget>();
+        }
 
-            return res.as_weak();
+        template<constraint::decayed_type TTarget>
+            requires rpp::constraint::static_pointer_convertible_to<TDisposable, TTarget>
+        operator disposable_wrapper_impl<TTarget>() &&
+        {
+            return std::move(*this).template convert_to<TTarget>();
         }
 
     private:
         using details::disposable_wrapper_base::disposable_wrapper_base;
+
+        template<constraint::decayed_type TTarget>
+        disposable_wrapper_impl<TTarget> convert_to() && noexcept
+        {
+            // pointer to `interface_disposable` is the same for any wrapper type, so just pass ownership of reference
+            const auto [ptr, block, is_weak] = std::move(*this).release();
+            return disposable_wrapper_impl<TTarget>{ptr, block, is_weak};
+        }
     };
 } // namespace rpp
 
@@ -226,18 +359,51 @@ namespace rpp::details
     protected:
         enable_wrapper_from_this() = default;
 
-        void set_weak_self(std::weak_ptr<interface_disposable> weak)
+        void set_control_block(disposable_control_block* block)
         {
-            m_weak = std::move(weak);
+            m_block = block;
         }
 
     public:
+        /**
+         * @brief Wrapper owning this disposable. Empty if disposable is being destroyed.
+         * @details Reference counters are stored right near the disposable, so there is no any weak_ptr to lock: just increment of counter if it is not zero yet.
+         */
         disposable_wrapper_impl<TStrategy> wrapper_from_this() const
         {
-            return disposable_wrapper_impl<TStrategy>(std::static_pointer_cast<interface_disposable>(m_weak.lock()));
+            if (!m_block || !m_block->try_add_ref())
+                return disposable_wrapper_impl<TStrategy>::empty();
+
+            return disposable_wrapper_impl<TStrategy>{get_self(), m_block, false};
+        }
+
+        /**
+         * @brief Same as `wrapper_from_this().as_weak()`, but without obtaining of strong reference in the middle
+         */
+        disposable_wrapper_impl<TStrategy> weak_wrapper_from_this() const
+        {
+            if (!m_block)
+                return disposable_wrapper_impl<TStrategy>::empty();
+
+            m_block->add_weak_ref();
+            return disposable_wrapper_impl<TStrategy>{get_self(), m_block, true};
+        }
+
+    protected:
+        /**
+         * @brief Same as `wrapper_from_this`, but adopts strong reference already counted by control block (for example, initial one) instead of obtaining new one
+         */
+        disposable_wrapper_impl<TStrategy> adopt_wrapper_from_this() const
+        {
+            return disposable_wrapper_impl<TStrategy>{get_self(), m_block, false};
         }
 
     private:
-        std::weak_ptr<interface_disposable> m_weak{};
+        interface_disposable* get_self() const
+        {
+            return static_cast<interface_disposable*>(const_cast<TStrategy*>(static_cast<const TStrategy*>(this)));
+        }
+
+        disposable_control_block* m_block{};
     };
 } // namespace rpp::details
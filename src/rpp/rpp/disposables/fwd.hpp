@@ -16,6 +16,8 @@ namespace rpp::details
 {
     template<rpp::constraint::decayed_type TDisposable>
     class auto_dispose_wrapper;
+
+    class refcount_disposable_ref_slot;
 } // namespace rpp::details
 
 namespace rpp
@@ -26,6 +28,9 @@ namespace rpp
     template<rpp::constraint::decayed_type TDisposable>
     class disposable_wrapper_impl;
 
+    template<typename T>
+    class disposable_ptr;
+
     /**
      * @brief Wrapper to keep "simple" disposable. Specialization of rpp::disposable_wrapper_impl
      *
@@ -51,6 +56,17 @@ namespace rpp::details::disposables
 
     struct none_disposables_container;
 
+    class slots_disposables_container;
+
+    /**
+     * @brief Handle of disposable added to `slots_disposables_container`. Generation protects from removing of other disposable placed later into same slot.
+     */
+    struct disposable_handle
+    {
+        size_t index      = static_cast<size_t>(-1);
+        size_t generation = 0;
+    };
+
     namespace constraint
     {
         template<typename T>
@@ -59,6 +75,14 @@ namespace rpp::details::disposables
             const_c.dispose();
             c.clear();
         };
+
+        template<typename T>
+        concept disposable_container_with_handles = disposable_container<T> && requires(T& c, const rpp::disposable_wrapper& d, const disposable_handle& handle) {
+            {
+                c.push_back_with_handle(d)
+            } -> std::same_as<disposable_handle>;
+            c.remove(handle);
+        };
     } // namespace constraint
 } // namespace rpp::details::disposables
 
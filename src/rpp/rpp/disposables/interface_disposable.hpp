@@ -38,6 +38,8 @@ namespace rpp
         template<rpp::constraint::decayed_type TStrategy>
         friend class rpp::details::auto_dispose_wrapper;
 
+        friend class rpp::details::refcount_disposable_ref_slot;
+
     protected:
         enum class Mode : bool
         {
@@ -16,12 +16,18 @@
 #include <rpp/disposables/details/base_disposable.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
 
+#include <rpp/instrumentation.hpp>
+
+#include <array>
 #include <atomic>
 #include <limits>
+#include <memory>
 
 namespace rpp::details
 {
     class refocunt_disposable_inner;
+    class refcount_disposable_ref;
+    class refcount_disposable_refs_pool;
 } // namespace rpp::details
 
 namespace rpp
@@ -32,11 +38,12 @@ namespace rpp
 
         void release()
         {
-            auto current_value = m_refcount.load(std::memory_order::seq_cst);
+            auto current_value = m_refcount.load(std::memory_order::relaxed);
             while (current_value != s_disposed)
             {
                 const size_t new_value = current_value == 1 ? s_disposed : current_value - 1;
-                if (!m_refcount.compare_exchange_strong(current_value, new_value, std::memory_order::seq_cst))
+                // release own usages of state before last reference disposes it, last reference acquires all of them
+                if (!m_refcount.compare_exchange_strong(current_value, new_value, std::memory_order::acq_rel, std::memory_order::relaxed))
                     continue;
 
                 if (new_value == s_disposed)
@@ -45,14 +52,15 @@ namespace rpp
             }
         }
 
-        void composite_dispose_impl(interface_disposable::Mode) noexcept override
-        {
-            m_refcount.store(s_disposed, std::memory_order::seq_cst);
-        }
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override;
+
+        details::refcount_disposable_refs_pool& get_pool();
 
     public:
         friend class details::refocunt_disposable_inner;
+        friend class details::refcount_disposable_ref;
         refcount_disposable() = default;
+        ~refcount_disposable() noexcept override;
 
         enum class Mode : bool
         {
@@ -62,8 +70,9 @@ namespace rpp
         composite_disposable_wrapper add_ref(Mode mode = Mode::WeakRefStrongSource);
 
     private:
-        std::atomic<size_t>     m_refcount{0};
-        constexpr static size_t s_disposed = std::numeric_limits<size_t>::max();
+        std::atomic<size_t>                                  m_refcount{0};
+        std::atomic<details::refcount_disposable_refs_pool*> m_pool{};
+        constexpr static size_t                              s_disposed = std::numeric_limits<size_t>::max();
     };
 } // namespace rpp
 
@@ -92,25 +101,244 @@ namespace rpp::details
         disposable_wrapper_impl<refcount_disposable> m_state;
     };
 
+    /**
+     * @brief Reference obtained via `refcount_disposable::add_ref` with `WeakRefStrongSource` mode. Keeps source alive and releases it once on disposing.
+     * @details Lives inside of `refcount_disposable_ref_slot` of source's pool, so source doesn't keep it in own container: source disposes alive references by iterating over pool.
+     */
+    class refcount_disposable_ref final : public rpp::composite_disposable
+        , public rpp::details::enable_wrapper_from_this<refcount_disposable_ref>
+    {
+    public:
+        friend class refcount_disposable_ref_slot;
+
+        explicit refcount_disposable_ref(disposable_ptr<refcount_disposable> state)
+            : m_state{std::move(state)}
+        {
+        }
+
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            if (const auto state = std::move(m_state))
+                state->release();
+        }
+
+    private:
+        disposable_ptr<refcount_disposable> m_state;
+    };
+
+    /**
+     * @brief Control block and memory for one `refcount_disposable_ref`. Slot is re-used for next reference after last weak reference to previous one is released.
+     */
+    class refcount_disposable_ref_slot final : public disposable_control_block
+    {
+    public:
+        refcount_disposable_ref_slot()
+            : disposable_control_block{nullptr}
+        {
+        }
+
+        // m_data is destroyed in `destroy` after last strong reference
+        ~refcount_disposable_ref_slot() noexcept override {}
+
+        bool try_acquire() noexcept
+        {
+            // need to acquire memory released by previous usage of slot
+            return !m_used.load(std::memory_order::relaxed) && !m_used.exchange(true, std::memory_order::acquire);
+        }
+
+        composite_disposable_wrapper emplace(refcount_disposable_refs_pool& pool, disposable_ptr<refcount_disposable> state)
+        {
+            m_pool = &pool;
+            std::construct_at(&m_data, std::move(state));
+            m_data.set_control_block(this);
+            reset_refs();
+            return m_data.adopt_wrapper_from_this();
+        }
+
+        /**
+         * @brief Strong reference to reference placed in slot if it is still alive
+         */
+        composite_disposable_wrapper lock() noexcept
+        {
+            if (!try_add_ref())
+                return composite_disposable_wrapper::empty();
+
+            // pairs with release in `reset_refs`: reference is constructed
+            std::atomic_thread_fence(std::memory_order::acquire);
+            return m_data.adopt_wrapper_from_this();
+        }
+
+    private:
+        void destroy() noexcept override
+        {
+            static_cast<interface_disposable&>(m_data).dispose_impl(rpp::interface_disposable::Mode::Destroying);
+            std::destroy_at(&m_data);
+        }
+
+        void deallocate() noexcept override;
+
+        union
+        {
+            refcount_disposable_ref m_data;
+        };
+        refcount_disposable_refs_pool* m_pool{};
+        std::atomic<bool>              m_used{};
+    };
+
+    /**
+     * @brief Storage of references of `refcount_disposable`. Slots are grouped into chunks which are never freed before pool itself, so obtaining of reference is just lock-free search of free slot.
+     * @details Pool is owned by `refcount_disposable` and by all used slots, so memory of reference stays valid even after destruction of source.
+     */
+    class refcount_disposable_refs_pool
+    {
+        static constexpr size_t s_chunk_size = 4;
+
+        struct chunk
+        {
+            std::array<refcount_disposable_ref_slot, s_chunk_size> slots{};
+            std::atomic<chunk*>                                    next{};
+        };
+
+    public:
+        refcount_disposable_refs_pool()
+        {
+            instrumentation::on_allocated(instrumentation::category::disposables, sizeof(refcount_disposable_refs_pool));
+        }
+
+        refcount_disposable_refs_pool(const refcount_disposable_refs_pool&) = delete;
+
+        ~refcount_disposable_refs_pool() noexcept
+        {
+            auto* next = m_first.next.load(std::memory_order::relaxed);
+            while (next)
+            {
+                delete std::exchange(next, next->next.load(std::memory_order::relaxed));
+                instrumentation::on_deallocated(instrumentation::category::disposables, sizeof(chunk));
+            }
+            instrumentation::on_deallocated(instrumentation::category::disposables, sizeof(refcount_disposable_refs_pool));
+        }
+
+        composite_disposable_wrapper add_ref(disposable_ptr<refcount_disposable> state)
+        {
+            auto& slot = acquire_slot();
+            // just need atomicity: slot keeps pool alive till it is free again
+            m_owners.fetch_add(1, std::memory_order::relaxed);
+            return slot.emplace(*this, std::move(state));
+        }
+
+        void dispose_refs() noexcept
+        {
+            for (auto* c = &m_first; c; c = c->next.load(std::memory_order::acquire))
+            {
+                for (auto& slot : c->slots)
+                    slot.lock().dispose();
+            }
+        }
+
+        void release_slot(std::atomic<bool>& used) noexcept
+        {
+            used.store(false, std::memory_order::release);
+            release();
+        }
+
+        void release() noexcept
+        {
+            if (m_owners.fetch_sub(1, std::memory_order::acq_rel) == 1)
+                delete this;
+        }
+
+    private:
+        refcount_disposable_ref_slot& acquire_slot()
+        {
+            for (auto* c = &m_first; c; c = c->next.load(std::memory_order::acquire))
+            {
+                for (auto& slot : c->slots)
+                {
+                    if (slot.try_acquire())
+                        return slot;
+                }
+            }
+
+            auto* new_chunk = new chunk{};
+            instrumentation::on_allocated(instrumentation::category::disposables, sizeof(chunk));
+            // not published yet, so can't fail
+            static_cast<void>(new_chunk->slots[0].try_acquire());
+
+            auto* next = m_first.next.load(std::memory_order::relaxed);
+            do
+            {
+                new_chunk->next.store(next, std::memory_order::relaxed);
+            } while (!m_first.next.compare_exchange_weak(next, new_chunk, std::memory_order::release, std::memory_order::relaxed));
+
+            return new_chunk->slots[0];
+        }
+
+        chunk               m_first{};
+        std::atomic<size_t> m_owners{1};
+    };
+
+    inline void refcount_disposable_ref_slot::deallocate() noexcept
+    {
+        m_pool->release_slot(m_used);
+    }
 } // namespace rpp::details
 
 namespace rpp
 {
     inline composite_disposable_wrapper refcount_disposable::add_ref(refcount_disposable::Mode mode)
     {
-        auto current_value = m_refcount.load(std::memory_order::seq_cst);
+        auto current_value = m_refcount.load(std::memory_order::relaxed);
         while (true)
         {
             if (current_value == s_disposed)
                 return composite_disposable_wrapper::empty();
 
             // just need atomicity, not guarding anything
-            if (m_refcount.compare_exchange_strong(current_value, current_value + 1, std::memory_order::seq_cst))
+            if (m_refcount.compare_exchange_strong(current_value, current_value + 1, std::memory_order::relaxed))
             {
-                auto inner = composite_disposable_wrapper::make<details::refocunt_disposable_inner>(mode == Mode::WeakRefStrongSource ? wrapper_from_this() : wrapper_from_this().as_weak());
-                add(mode == Mode::WeakRefStrongSource ? inner.as_weak() : inner);
-                return inner;
+                if (mode == Mode::StrongRefRefSource)
+                {
+                    auto inner = composite_disposable_wrapper::make<details::refocunt_disposable_inner>(weak_wrapper_from_this());
+                    add(inner);
+                    return inner;
+                }
+
+                auto ref = get_pool().add_ref(wrapper_from_this().lock());
+                // disposing could miss reference published concurrently, so check it after publishing. Pairs with fence in `composite_dispose_impl`
+                std::atomic_thread_fence(std::memory_order::seq_cst);
+                if (is_disposed())
+                    ref.dispose();
+                return ref;
             }
         }
     }
+
+    inline void refcount_disposable::composite_dispose_impl(interface_disposable::Mode) noexcept
+    {
+        m_refcount.store(s_disposed, std::memory_order::relaxed);
+
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        if (auto* pool = m_pool.load(std::memory_order::acquire))
+            pool->dispose_refs();
+    }
+
+    inline refcount_disposable::~refcount_disposable() noexcept
+    {
+        if (auto* pool = m_pool.load(std::memory_order::relaxed))
+            pool->release();
+    }
+
+    inline details::refcount_disposable_refs_pool& refcount_disposable::get_pool()
+    {
+        if (auto* pool = m_pool.load(std::memory_order::acquire))
+            return *pool;
+
+        auto*                                   pool     = new details::refcount_disposable_refs_pool{};
+        details::refcount_disposable_refs_pool* expected = nullptr;
+        if (m_pool.compare_exchange_strong(expected, pool, std::memory_order::acq_rel, std::memory_order::acquire))
+            return *pool;
+
+        pool->release();
+        return *expected;
+    }
 } // namespace rpp
@@ -0,0 +1,160 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <string_view>
+
+namespace rpp::instrumentation
+{
+    /**
+     * @brief Categories of internal objects tracked by instrumentation
+     */
+    enum class category : size_t
+    {
+        disposables,        // disposables created via `rpp::disposable_wrapper_impl::make` (including states of subjects and operators)
+        dynamic_observers,  // observers type-erased by `rpp::dynamic_observer`
+        schedulables,       // schedulables allocated by schedulers' queues
+        subject_observers,  // observers subscribed to subjects (their memory is part of `disposables` too)
+    };
+
+    inline constexpr size_t categories_count = 4;
+
+    constexpr std::string_view to_string(category c)
+    {
+        switch (c)
+        {
+        case category::disposables: return "disposables";
+        case category::dynamic_observers: return "dynamic_observers";
+        case category::schedulables: return "schedulables";
+        case category::subject_observers: return "subject_observers";
+        }
+        return "unknown";
+    }
+
+    struct counters
+    {
+        size_t allocations{}; // total amount of heap allocations made for objects of category
+        size_t reused{};      // total amount of objects placed to memory reused from internal pool instead of heap allocation
+        size_t alive{};       // amount of currently alive objects
+        size_t alive_bytes{}; // amount of heap memory held by currently alive objects
+    };
+
+    struct snapshot
+    {
+        std::array<counters, categories_count> values{};
+
+        const counters& operator[](category c) const { return values[static_cast<size_t>(c)]; }
+    };
+
+    /**
+     * @brief True if instrumentation is enabled via `RPP_ENABLE_INSTRUMENTATION` macro (or same CMake option). It must be same for all translation units.
+     */
+#ifdef RPP_ENABLE_INSTRUMENTATION
+    inline constexpr bool is_enabled = true;
+#else
+    inline constexpr bool is_enabled = false;
+#endif
+} // namespace rpp::instrumentation
+
+namespace rpp::details::instrumentation
+{
+    using rpp::instrumentation::category;
+
+#ifdef RPP_ENABLE_INSTRUMENTATION
+    struct atomic_counters
+    {
+        // just need atomicity, not guarding anything
+        std::atomic<size_t> allocations{};
+        std::atomic<size_t> reused{};
+        std::atomic<size_t> alive{};
+        std::atomic<size_t> alive_bytes{};
+    };
+
+    inline std::array<atomic_counters, rpp::instrumentation::categories_count> s_counters{};
+
+    inline atomic_counters& get(category c) noexcept { return s_counters[static_cast<size_t>(c)]; }
+
+    /**
+     * @brief Object of category allocated in heap
+     */
+    inline void on_allocated(category c, size_t bytes) noexcept
+    {
+        auto& counters = get(c);
+        counters.allocations.fetch_add(1, std::memory_order::relaxed);
+        counters.alive.fetch_add(1, std::memory_order::relaxed);
+        counters.alive_bytes.fetch_add(bytes, std::memory_order::relaxed);
+    }
+
+    /**
+     * @brief Object of category placed to memory reused from internal pool (no heap allocation)
+     */
+    inline void on_reused(category c, size_t bytes) noexcept
+    {
+        auto& counters = get(c);
+        counters.reused.fetch_add(1, std::memory_order::relaxed);
+        counters.alive.fetch_add(1, std::memory_order::relaxed);
+        counters.alive_bytes.fetch_add(bytes, std::memory_order::relaxed);
+    }
+
+    inline void on_deallocated(category c, size_t bytes) noexcept
+    {
+        auto& counters = get(c);
+        counters.alive.fetch_sub(1, std::memory_order::relaxed);
+        counters.alive_bytes.fetch_sub(bytes, std::memory_order::relaxed);
+    }
+
+    /**
+     * @brief Object of category created without own heap allocation (for example, inside of another object)
+     */
+    inline void on_created(category c) noexcept
+    {
+        get(c).alive.fetch_add(1, std::memory_order::relaxed);
+    }
+
+    inline void on_destroyed(category c) noexcept
+    {
+        get(c).alive.fetch_sub(1, std::memory_order::relaxed);
+    }
+#else
+    inline void on_allocated(category, size_t) noexcept {}
+    inline void on_reused(category, size_t) noexcept {}
+    inline void on_deallocated(category, size_t) noexcept {}
+    inline void on_created(category) noexcept {}
+    inline void on_destroyed(category) noexcept {}
+#endif
+} // namespace rpp::details::instrumentation
+
+namespace rpp::instrumentation
+{
+    /**
+     * @brief Current values of counters of all categories. Returns zeros if instrumentation is disabled.
+     * @details Useful to find leaks: amount of alive objects should return to previous value after all subscriptions are disposed.
+     *
+     * @note Define `RPP_ENABLE_INSTRUMENTATION` (or enable same CMake option) to enable it. Disabled instrumentation has no any runtime cost.
+     */
+    inline snapshot take_snapshot()
+    {
+        snapshot result{};
+#ifdef RPP_ENABLE_INSTRUMENTATION
+        for (size_t i = 0; i < categories_count; ++i)
+        {
+            const auto& counters = rpp::details::instrumentation::s_counters[i];
+            result.values[i]     = {.allocations = counters.allocations.load(std::memory_order::relaxed),
+                                    .reused      = counters.reused.load(std::memory_order::relaxed),
+                                    .alive       = counters.alive.load(std::memory_order::relaxed),
+                                    .alive_bytes = counters.alive_bytes.load(std::memory_order::relaxed)};
+        }
+#endif
+        return result;
+    }
+} // namespace rpp::instrumentation
@@ -98,6 +98,53 @@ namespace rpp::details::observables
             else
                 return static_cast<default_disposable_strategy_selector*>(nullptr);
         }
+
+        consteval AtomicMode max_atomic_mode(AtomicMode lhs, AtomicMode rhs)
+        {
+            return lhs == AtomicMode::Atomic || rhs == AtomicMode::Atomic ? AtomicMode::Atomic : AtomicMode::NonAtomic;
+        }
+
+        template<typename Lhs, typename Rhs>
+        struct sum_of_two_disposable_strategies
+        {
+            using type = default_disposable_strategy_selector;
+        };
+
+        template<size_t LhsCount, AtomicMode LhsMode, size_t RhsCount, AtomicMode RhsMode>
+        struct sum_of_two_disposable_strategies<fixed_disposable_strategy_selector<LhsCount, LhsMode>, fixed_disposable_strategy_selector<RhsCount, RhsMode>>
+        {
+            using type = fixed_disposable_strategy_selector<LhsCount + RhsCount, max_atomic_mode(LhsMode, RhsMode)>;
+        };
+
+        template<size_t LhsCount, AtomicMode LhsMode, size_t RhsCount, AtomicMode RhsMode>
+        struct sum_of_two_disposable_strategies<fixed_disposable_strategy_selector<LhsCount, LhsMode>, dynamic_disposable_strategy_selector<RhsCount, RhsMode>>
+        {
+            using type = dynamic_disposable_strategy_selector<LhsCount + RhsCount, max_atomic_mode(LhsMode, RhsMode)>;
+        };
+
+        template<size_t LhsCount, AtomicMode LhsMode, size_t RhsCount, AtomicMode RhsMode>
+        struct sum_of_two_disposable_strategies<dynamic_disposable_strategy_selector<LhsCount, LhsMode>, fixed_disposable_strategy_selector<RhsCount, RhsMode>>
+        {
+            using type = dynamic_disposable_strategy_selector<LhsCount + RhsCount, max_atomic_mode(LhsMode, RhsMode)>;
+        };
+
+        template<size_t LhsCount, AtomicMode LhsMode, size_t RhsCount, AtomicMode RhsMode>
+        struct sum_of_two_disposable_strategies<dynamic_disposable_strategy_selector<LhsCount, LhsMode>, dynamic_disposable_strategy_selector<RhsCount, RhsMode>>
+        {
+            using type = dynamic_disposable_strategy_selector<LhsCount + RhsCount, max_atomic_mode(LhsMode, RhsMode)>;
+        };
+
+        template<typename Strategy, typename... Rest>
+        struct sum_of_disposable_strategies
+        {
+            using type = Strategy;
+        };
+
+        template<typename Lhs, typename Rhs, typename... Rest>
+        struct sum_of_disposable_strategies<Lhs, Rhs, Rest...>
+        {
+            using type = typename sum_of_disposable_strategies<typename sum_of_two_disposable_strategies<Lhs, Rhs>::type, Rest...>::type;
+        };
     } // namespace details
 
     template<typename T>
@@ -106,6 +153,13 @@ namespace rpp::details::observables
     template<typename T, typename Prev>
     using deduce_updated_disposable_strategy = std::remove_pointer_t<decltype(details::deduce_updated_disposable_strategy<T, Prev>())>;
 
+    /**
+     * @brief Strategy for observer obtaining disposables from multiple sources at the same time (for example, observer shared between original observable and observables passed to operator): amounts of disposables are summed up.
+     * @details Result is fixed (static container) only if all of strategies are fixed, dynamic if any of them is dynamic and default if amount of any of them is unknown. Result is atomic if any of them is atomic.
+     */
+    template<typename... Strategies>
+    using sum_of_disposable_strategies = typename details::sum_of_disposable_strategies<Strategies...>::type;
+
     namespace constraint
     {
         template<typename T>
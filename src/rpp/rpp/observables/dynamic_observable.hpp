@@ -14,62 +14,155 @@
 #include <rpp/observables/observable.hpp>
 #include <rpp/observers/dynamic_observer.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace rpp::details::observables
 {
     template<typename T, typename Observable>
-    void forwarding_subscribe(const void* const ptr, dynamic_observer<T>&& obs)
+    void forwarding_subscribe(const void* const ptr, observer<T, rpp::details::observers::inplace_dynamic_strategy<T>>&& obs)
     {
-        static_cast<const Observable*>(ptr)->subscribe(std::move(obs));
+        std::launder(static_cast<const Observable*>(ptr))->subscribe(std::move(obs));
     }
 
+    template<typename T, typename Observable>
+    void forwarding_shared_subscribe(const void* const ptr, observer<T, rpp::details::observers::inplace_dynamic_strategy<T>>&& obs)
+    {
+        std::launder(static_cast<const std::shared_ptr<const Observable>*>(ptr))->get()->subscribe(std::move(obs));
+    }
+
+    /**
+     * @brief Type-erased strategy of `rpp::dynamic_observable`.
+     * @details Small observables with noexcept copy are placed right inside of strategy, other ones are placed to `std::shared_ptr` shared between copies.
+     */
     template<rpp::constraint::decayed_type Type>
     class dynamic_strategy final
     {
+        using inplace_observer = observer<Type, rpp::details::observers::inplace_dynamic_strategy<Type>>;
+
+        static constexpr size_t storage_size = 3 * sizeof(void*);
+
+        template<typename Observable>
+        static constexpr bool is_inlinable = sizeof(Observable) <= storage_size && alignof(Observable) <= alignof(void*) && std::is_nothrow_copy_constructible_v<Observable> && std::is_nothrow_move_constructible_v<Observable>;
+
     public:
         using value_type = Type;
 
         template<rpp::constraint::observable_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(observable<Type, Strategy>&& obs)
-            : m_forwarder{std::make_shared<observable<Type, Strategy>>(std::move(obs))}
-            , m_vtable{vtable::template create<observable<Type, Strategy>>()}
         {
+            emplace<observable<Type, Strategy>>(std::move(obs));
         }
 
         template<rpp::constraint::observable_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(const observable<Type, Strategy>& obs)
-            : m_forwarder{std::make_shared<observable<Type, Strategy>>(obs)}
-            , m_vtable{vtable::template create<observable<Type, Strategy>>()}
         {
+            emplace<observable<Type, Strategy>>(obs);
+        }
+
+        dynamic_strategy(const dynamic_strategy& other) noexcept
+            : m_vtable{other.m_vtable}
+        {
+            m_vtable->copy(other.m_storage, m_storage);
+        }
+
+        dynamic_strategy(dynamic_strategy&& other) noexcept
+            : m_vtable{other.m_vtable}
+        {
+            m_vtable->move(other.m_storage, m_storage);
+        }
+
+        dynamic_strategy& operator=(const dynamic_strategy& other) noexcept
+        {
+            if (this != &other)
+            {
+                m_vtable->destroy(m_storage);
+                m_vtable = other.m_vtable;
+                m_vtable->copy(other.m_storage, m_storage);
+            }
+            return *this;
+        }
+
+        dynamic_strategy& operator=(dynamic_strategy&& other) noexcept
+        {
+            if (this != &other)
+            {
+                m_vtable->destroy(m_storage);
+                m_vtable = other.m_vtable;
+                m_vtable->move(other.m_storage, m_storage);
+            }
+            return *this;
+        }
+
+        ~dynamic_strategy() noexcept
+        {
+            m_vtable->destroy(m_storage);
         }
 
         template<rpp::constraint::observer_strategy<Type> ObserverStrategy>
         void subscribe(observer<Type, ObserverStrategy>&& observer) const
         {
-            m_vtable->subscribe(m_forwarder.get(), std::move(observer).as_dynamic());
+            // small observers are passed through type-erasure without heap allocation, bigger ones are converted to dynamic_observer
+            m_vtable->subscribe(m_storage, inplace_observer{std::move(observer)});
         }
 
     private:
         struct vtable
         {
-            void (*subscribe)(const void*, dynamic_observer<Type>&&){};
+            void (*subscribe)(const void*, inplace_observer&&){};
+
+            void (*copy)(const void* from, void* to){};
+            void (*move)(void* from, void* to){};
+            void (*destroy)(void*){};
 
             template<rpp::constraint::observable Observable>
             static const vtable* create() noexcept
             {
-                static vtable s_res{
-                    .subscribe = forwarding_subscribe<Type, Observable>};
+                static constexpr vtable s_res{
+                    .subscribe = forwarding_subscribe<Type, Observable>,
+                    .copy      = +[](const void* from, void* to) { new (to) Observable{*std::launder(static_cast<const Observable*>(from))}; },
+                    .move      = +[](void* from, void* to) { new (to) Observable{std::move(*std::launder(static_cast<Observable*>(from)))}; },
+                    .destroy   = +[](void* ptr) { std::launder(static_cast<Observable*>(ptr))->~Observable(); }};
+                return &s_res;
+            }
+
+            template<rpp::constraint::observable Observable>
+            static const vtable* create_shared() noexcept
+            {
+                using ptr_t = std::shared_ptr<const Observable>;
+
+                static constexpr vtable s_res{
+                    .subscribe = forwarding_shared_subscribe<Type, Observable>,
+                    .copy      = +[](const void* from, void* to) { new (to) ptr_t{*std::launder(static_cast<const ptr_t*>(from))}; },
+                    .move      = +[](void* from, void* to) { new (to) ptr_t{std::move(*std::launder(static_cast<ptr_t*>(from)))}; },
+                    .destroy   = +[](void* ptr) { std::launder(static_cast<ptr_t*>(ptr))->~ptr_t(); }};
                 return &s_res;
             }
         };
 
+        template<rpp::constraint::observable Observable, typename TObservable>
+        void emplace(TObservable&& obs)
+        {
+            if constexpr (is_inlinable<Observable>)
+            {
+                new (m_storage) Observable{std::forward<TObservable>(obs)};
+                m_vtable = vtable::template create<Observable>();
+            }
+            else
+            {
+                new (m_storage) std::shared_ptr<const Observable>{std::make_shared<Observable>(std::forward<TObservable>(obs))};
+                m_vtable = vtable::template create_shared<Observable>();
+            }
+        }
+
     private:
-        std::shared_ptr<void> m_forwarder;
-        const vtable*         m_vtable;
+        alignas(void*) std::byte m_storage[storage_size];
+        const vtable*            m_vtable{};
     };
 } // namespace rpp::details::observables
 
@@ -77,7 +170,7 @@ namespace rpp
 {
     /**
      * @brief Type-erased version of the `rpp::observable`. Any observable can be converted to dynamic_observable via `rpp::observable::as_dynamic` member function.
-     * @details To provide type-erasure it uses `std::shared_ptr`. As a result it has worse performance.
+     * @details Small observables are stored inline, bigger ones are stored in `std::shared_ptr`. Observers are passed to original observable via move-only type-erased wrapper keeping small observers inline too. As a result it has worse performance due to indirect calls.
      *
      * @tparam Type of value this obsevalbe can provide
      *
@@ -25,20 +25,20 @@ namespace rpp::details::observers
         atomic_bool() = default;
         atomic_bool(atomic_bool&& other) noexcept
             // just need atomicity, not guarding anything
-            : m_value{other.m_value.load(std::memory_order::seq_cst)}
+            : m_value{other.m_value.load(std::memory_order::relaxed)}
         {
         }
 
         bool test() const noexcept
         {
             // just need atomicity, not guarding anything
-            return m_value.load(std::memory_order::seq_cst);
+            return m_value.load(std::memory_order::relaxed);
         }
 
         void set() noexcept
         {
             // just need atomicity, not guarding anything
-            m_value.store(true, std::memory_order::seq_cst);
+            m_value.store(true, std::memory_order::relaxed);
         }
 
     private:
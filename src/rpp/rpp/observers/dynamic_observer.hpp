@@ -12,9 +12,13 @@
 #include <rpp/disposables/fwd.hpp>
 #include <rpp/observers/fwd.hpp>
 
+#include <rpp/instrumentation.hpp>
 #include <rpp/observers/observer.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace rpp::details::observers
@@ -23,32 +27,40 @@ namespace rpp::details::observers
     class observer_vtable
     {
     public:
-        void set_upstream(const disposable_wrapper& d) noexcept { m_vtable.set_upstream_ptr(this, d); }
-        bool is_disposed() const noexcept { return m_vtable.is_disposed_ptr(this); }
+        using on_next_lvalue_fn = void (*)(const observer_vtable*, const Type&);
 
-        void on_next(const Type& v) const noexcept { m_vtable.on_next_lvalue_ptr(this, v); }
-        void on_next(Type&& v) const noexcept { m_vtable.on_next_rvalue_ptr(this, std::move(v)); }
-        void on_error(const std::exception_ptr& err) const noexcept { m_vtable.on_error_ptr(this, err); }
-        void on_completed() const noexcept { m_vtable.on_completed_ptr(this); }
+        /**
+         * @brief Function used by `on_next(const Type&)`. Owner of a lot of observers can keep it right next to pointer to observer to avoid extra indirection per each value.
+         */
+        on_next_lvalue_fn get_on_next_lvalue() const noexcept { return m_vtable->on_next_lvalue_ptr; }
+
+        void set_upstream(const disposable_wrapper& d) noexcept { m_vtable->set_upstream_ptr(this, d); }
+        bool is_disposed() const noexcept { return m_vtable->is_disposed_ptr(this); }
+
+        void on_next(const Type& v) const noexcept { m_vtable->on_next_lvalue_ptr(this, v); }
+        void on_next(Type&& v) const noexcept { m_vtable->on_next_rvalue_ptr(this, std::move(v)); }
+        void on_error(const std::exception_ptr& err) const noexcept { m_vtable->on_error_ptr(this, err); }
+        void on_completed() const noexcept { m_vtable->on_completed_ptr(this); }
 
     protected:
         struct vtable_t
         {
-            void (*const on_next_lvalue_ptr)(const observer_vtable*, const Type&){};
-            void (*const on_next_rvalue_ptr)(const observer_vtable*, Type&&){};
-            void (*const on_error_ptr)(const observer_vtable*, const std::exception_ptr&){};
-            void (*const on_completed_ptr)(const observer_vtable*){};
+            void (*on_next_lvalue_ptr)(const observer_vtable*, const Type&){};
+            void (*on_next_rvalue_ptr)(const observer_vtable*, Type&&){};
+            void (*on_error_ptr)(const observer_vtable*, const std::exception_ptr&){};
+            void (*on_completed_ptr)(const observer_vtable*){};
 
-            void (*const set_upstream_ptr)(observer_vtable*, const disposable_wrapper&){};
-            bool (*const is_disposed_ptr)(const observer_vtable*){};
+            void (*set_upstream_ptr)(observer_vtable*, const disposable_wrapper&){};
+            bool (*is_disposed_ptr)(const observer_vtable*){};
         };
 
-        observer_vtable(vtable_t&& vtable)
-            : m_vtable{std::move(vtable)}
+        explicit observer_vtable(const vtable_t* vtable)
+            : m_vtable{vtable}
         {
         }
 
-        const vtable_t m_vtable{};
+    private:
+        const vtable_t* m_vtable;
     };
 
     template<rpp::constraint::observer TObs>
@@ -68,17 +80,23 @@ namespace rpp::details::observers
             return static_cast<type_erased_observer*>(ptr)->m_observer;
         }
 
+        static const Vtable* vtable() noexcept
+        {
+            static constexpr Vtable s_res{
+                .on_next_lvalue_ptr = +[](const Base* b, const Type& v) { cast(b).on_next(v); },
+                .on_next_rvalue_ptr = +[](const Base* b, Type&& v) { cast(b).on_next(std::move(v)); },
+                .on_error_ptr       = +[](const Base* b, const std::exception_ptr& err) { cast(b).on_error(err); },
+                .on_completed_ptr   = +[](const Base* b) { cast(b).on_completed(); },
+                .set_upstream_ptr   = +[](Base* b, const rpp::disposable_wrapper& d) { cast(b).set_upstream(d); },
+                .is_disposed_ptr    = +[](const Base* b) {
+                    return cast(b).is_disposed();
+                }};
+            return &s_res;
+        }
+
     public:
         type_erased_observer(TObs&& observer)
-            : Base{Vtable{
-                  .on_next_lvalue_ptr = +[](const Base* b, const Type& v) { cast(b).on_next(v); },
-                  .on_next_rvalue_ptr = +[](const Base* b, Type&& v) { cast(b).on_next(std::move(v)); },
-                  .on_error_ptr       = +[](const Base* b, const std::exception_ptr& err) { cast(b).on_error(err); },
-                  .on_completed_ptr   = +[](const Base* b) { cast(b).on_completed(); },
-                  .set_upstream_ptr   = +[](Base* b, const rpp::disposable_wrapper& d) { cast(b).set_upstream(d); },
-                  .is_disposed_ptr    = +[](const Base* b) {
-                      return cast(b).is_disposed();
-                  }}}
+            : Base{vtable()}
             , m_observer{std::move(observer)}
         {
         }
@@ -87,6 +105,10 @@ namespace rpp::details::observers
         RPP_NO_UNIQUE_ADDRESS TObs m_observer;
     };
 
+    /**
+     * @brief Type-erased strategy of `rpp::dynamic_observer`.
+     * @details Observer is placed to `std::shared_ptr` right during construction, so copies of dynamic observer refer to the same observer and copying never modifies original one.
+     */
     template<rpp::constraint::decayed_type Type>
     class dynamic_strategy final
     {
@@ -94,7 +116,7 @@ namespace rpp::details::observers
         template<rpp::constraint::observer_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(observer<Type, Strategy>&& obs)
-            : m_observer{std::make_shared<type_erased_observer<observer<Type, Strategy>>>(std::move(obs))}
+            : m_observer{std::make_shared<heap_observer<observer<Type, Strategy>>>(std::move(obs))}
         {
         }
 
@@ -107,8 +129,149 @@ namespace rpp::details::observers
         void on_completed() const noexcept { m_observer->on_completed(); }
 
     private:
+        template<rpp::constraint::observer TObs>
+        class heap_observer final : public type_erased_observer<TObs>
+        {
+        public:
+            explicit heap_observer(TObs&& observer)
+                : type_erased_observer<TObs>{std::move(observer)}
+            {
+                instrumentation::on_allocated(instrumentation::category::dynamic_observers, sizeof(heap_observer));
+            }
+
+            heap_observer(const heap_observer&) = delete;
+            heap_observer(heap_observer&&)      = delete;
+
+            ~heap_observer() noexcept
+            {
+                instrumentation::on_deallocated(instrumentation::category::dynamic_observers, sizeof(heap_observer));
+            }
+        };
+
         std::shared_ptr<observer_vtable<Type>> m_observer;
     };
+
+    /**
+     * @brief Move-only type-erased strategy used to pass observer through type-erased boundary (for example, `rpp::dynamic_observable`).
+     * @details Observer can't be copied, so, it is never shared and small observers are placed right inside of strategy without any heap allocations. Bigger ones (or ones with throwing move) are converted to `rpp::dynamic_observer`. Heap allocation happens only if someone needs to copy observer and converts it to `rpp::dynamic_observer` via `as_dynamic`.
+     */
+    template<rpp::constraint::decayed_type Type>
+    class inplace_dynamic_strategy final
+    {
+        // enough for observer obtained by `subscribe` with lambdas and for a couple of operators on top of it
+        static constexpr size_t storage_size = 14 * sizeof(void*);
+
+        template<typename TObs>
+        static constexpr bool is_inlinable = sizeof(TObs) <= storage_size && alignof(TObs) <= alignof(void*) && std::is_nothrow_move_constructible_v<TObs>;
+
+    public:
+        template<rpp::constraint::observer_strategy<Type> Strategy>
+            requires (!rpp::constraint::decayed_same_as<Strategy, inplace_dynamic_strategy<Type>>)
+        explicit inplace_dynamic_strategy(observer<Type, Strategy>&& obs)
+        {
+            using TObs = observer<Type, Strategy>;
+
+            if constexpr (is_inlinable<TObs>)
+                emplace<TObs>(std::move(obs));
+            else
+                emplace<observer<Type, dynamic_strategy<Type>>>(std::move(obs).as_dynamic());
+        }
+
+        inplace_dynamic_strategy(const inplace_dynamic_strategy&) = delete;
+
+        inplace_dynamic_strategy(inplace_dynamic_strategy&& other) noexcept
+            : m_vtable{other.m_vtable}
+        {
+            m_vtable->move_ptr(other.m_storage, m_storage);
+        }
+
+        inplace_dynamic_strategy& operator=(const inplace_dynamic_strategy&) = delete;
+        inplace_dynamic_strategy& operator=(inplace_dynamic_strategy&&)      = delete;
+
+        ~inplace_dynamic_strategy() noexcept
+        {
+            m_vtable->destroy_ptr(m_storage);
+        }
+
+        void set_upstream(const disposable_wrapper& d) noexcept { m_vtable->set_upstream_ptr(m_storage, d); }
+        bool is_disposed() const noexcept { return m_vtable->is_disposed_ptr(m_storage); }
+
+        void on_next(const Type& v) const noexcept { m_vtable->on_next_lvalue_ptr(m_storage, v); }
+        void on_next(Type&& v) const noexcept { m_vtable->on_next_rvalue_ptr(m_storage, std::move(v)); }
+        void on_error(const std::exception_ptr& err) const noexcept { m_vtable->on_error_ptr(m_storage, err); }
+        void on_completed() const noexcept { m_vtable->on_completed_ptr(m_storage); }
+
+        dynamic_observer<Type> as_dynamic() && { return m_vtable->as_dynamic_ptr(m_storage); }
+
+    private:
+        struct vtable_t
+        {
+            void (*on_next_lvalue_ptr)(const void*, const Type&){};
+            void (*on_next_rvalue_ptr)(const void*, Type&&){};
+            void (*on_error_ptr)(const void*, const std::exception_ptr&){};
+            void (*on_completed_ptr)(const void*){};
+
+            void (*set_upstream_ptr)(void*, const disposable_wrapper&){};
+            bool (*is_disposed_ptr)(const void*){};
+
+            void (*move_ptr)(void* from, void* to){};
+            void (*destroy_ptr)(void*){};
+            dynamic_observer<Type> (*as_dynamic_ptr)(void*){};
+        };
+
+        template<typename T>
+        static T& get(void* storage) noexcept
+        {
+            return *std::launder(static_cast<T*>(storage));
+        }
+
+        template<typename T>
+        static const T& get(const void* storage) noexcept
+        {
+            return *std::launder(static_cast<const T*>(storage));
+        }
+
+        // dynamic_observer is already counted as allocation, so, only observers erased right there are counted as created
+        template<typename TObs>
+        static constexpr bool is_counted = !std::same_as<TObs, observer<Type, dynamic_strategy<Type>>>;
+
+        template<typename TObs>
+        static const vtable_t* create_vtable() noexcept
+        {
+            static constexpr vtable_t s_res{
+                .on_next_lvalue_ptr = +[](const void* s, const Type& v) { get<TObs>(s).on_next(v); },
+                .on_next_rvalue_ptr = +[](const void* s, Type&& v) { get<TObs>(s).on_next(std::move(v)); },
+                .on_error_ptr       = +[](const void* s, const std::exception_ptr& err) { get<TObs>(s).on_error(err); },
+                .on_completed_ptr   = +[](const void* s) { get<TObs>(s).on_completed(); },
+                .set_upstream_ptr   = +[](void* s, const disposable_wrapper& d) { get<TObs>(s).set_upstream(d); },
+                .is_disposed_ptr    = +[](const void* s) { return get<TObs>(s).is_disposed(); },
+                .move_ptr           = +[](void* from, void* to) {
+                    new (to) TObs{std::move(get<TObs>(from))};
+                    if constexpr (is_counted<TObs>)
+                        instrumentation::on_created(instrumentation::category::dynamic_observers);
+                },
+                .destroy_ptr = +[](void* s) {
+                    get<TObs>(s).~TObs();
+                    if constexpr (is_counted<TObs>)
+                        instrumentation::on_destroyed(instrumentation::category::dynamic_observers);
+                },
+                .as_dynamic_ptr = +[](void* s) -> dynamic_observer<Type> { return std::move(get<TObs>(s)).as_dynamic(); }};
+            return &s_res;
+        }
+
+        template<typename TObs, typename... Args>
+        void emplace(Args&&... args)
+        {
+            new (m_storage) TObs{std::forward<Args>(args)...};
+            m_vtable = create_vtable<TObs>();
+            if constexpr (is_counted<TObs>)
+                instrumentation::on_created(instrumentation::category::dynamic_observers);
+        }
+
+    private:
+        alignas(void*) std::byte m_storage[storage_size];
+        const vtable_t*          m_vtable{};
+    };
 } // namespace rpp::details::observers
 
 
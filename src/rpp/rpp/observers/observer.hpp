@@ -233,18 +233,35 @@ namespace rpp
         }
     };
 
+    /**
+     * @brief Type-erased observer doesn't have any own state and just forwards all calls to original observer. Original observer checks disposed state and handles exceptions by itself, so, there is no need to duplicate it.
+     */
     template<constraint::decayed_type Type>
     class observer<Type, rpp::details::observers::dynamic_strategy<Type>>
-        : public details::observer_impl<Type, rpp::details::observers::dynamic_strategy<Type>, details::observers::none_disposable_strategy>
     {
     public:
+        using preferred_disposable_strategy = details::observers::none_disposable_strategy;
+
         template<constraint::observer_strategy<Type> TStrategy>
-            requires (!std::same_as<TStrategy, rpp::details::observers::dynamic_strategy<Type>>)
+            requires (!std::same_as<TStrategy, rpp::details::observers::dynamic_strategy<Type>> && !std::same_as<TStrategy, rpp::details::observers::inplace_dynamic_strategy<Type>>)
         observer(observer<Type, TStrategy>&& other)
-            : details::observer_impl<Type, rpp::details::observers::dynamic_strategy<Type>, details::observers::none_disposable_strategy>{details::observers::none_disposable_strategy{}, std::move(other)}
+            : m_strategy{std::move(other)}
         {
         }
 
+        observer(observer<Type, rpp::details::observers::inplace_dynamic_strategy<Type>>&& other)
+            : observer{std::move(other).as_dynamic()}
+        {
+        }
+
+        void set_upstream(const disposable_wrapper& d) noexcept { m_strategy.set_upstream(d); }
+        bool is_disposed() const noexcept { return m_strategy.is_disposed(); }
+
+        void on_next(const Type& v) const noexcept { m_strategy.on_next(v); }
+        void on_next(Type&& v) const noexcept { m_strategy.on_next(std::move(v)); }
+        void on_error(const std::exception_ptr& err) const noexcept { m_strategy.on_error(err); }
+        void on_completed() const noexcept { m_strategy.on_completed(); }
+
         dynamic_observer<Type> as_dynamic() &&
         {
             return dynamic_observer<Type>{std::move(*this)};
@@ -254,6 +271,47 @@ namespace rpp
         {
             return dynamic_observer<Type>{*this};
         }
+
+    private:
+        rpp::details::observers::dynamic_strategy<Type> m_strategy;
+    };
+
+    /**
+     * @brief Move-only type-erased observer used to pass observer through type-erased boundary without heap allocation. Same as `rpp::dynamic_observer` it doesn't have any own state and just forwards all calls to original observer.
+     */
+    template<constraint::decayed_type Type>
+    class observer<Type, rpp::details::observers::inplace_dynamic_strategy<Type>>
+    {
+    public:
+        using preferred_disposable_strategy = details::observers::none_disposable_strategy;
+
+        template<constraint::observer_strategy<Type> TStrategy>
+            requires (!std::same_as<TStrategy, rpp::details::observers::inplace_dynamic_strategy<Type>>)
+        explicit observer(observer<Type, TStrategy>&& other)
+            : m_strategy{std::move(other)}
+        {
+        }
+
+        observer(observer&&) noexcept = default;
+
+        void set_upstream(const disposable_wrapper& d) noexcept { m_strategy.set_upstream(d); }
+        bool is_disposed() const noexcept { return m_strategy.is_disposed(); }
+
+        void on_next(const Type& v) const noexcept { m_strategy.on_next(v); }
+        void on_next(Type&& v) const noexcept { m_strategy.on_next(std::move(v)); }
+        void on_error(const std::exception_ptr& err) const noexcept { m_strategy.on_error(err); }
+        void on_completed() const noexcept { m_strategy.on_completed(); }
+
+        /**
+         * @brief Convert current observer to `rpp::dynamic_observer`. Original observer is moved to heap, except of case when it is `rpp::dynamic_observer` already.
+         */
+        dynamic_observer<Type> as_dynamic() &&
+        {
+            return std::move(m_strategy).as_dynamic();
+        }
+
+    private:
+        rpp::details::observers::inplace_dynamic_strategy<Type> m_strategy;
     };
 
 
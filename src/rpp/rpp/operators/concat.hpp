@@ -45,9 +45,9 @@ namespace rpp::operators::details
             get_observer()->set_upstream(d);
         }
 
-        rpp::utils::pointer_under_lock<TObserver>               get_observer() { return m_observer; }
-        rpp::utils::pointer_under_lock<std::queue<TObservable>> get_queue() { return m_queue; }
-        const std::shared_ptr<refcount_disposable>&             get_disposable() const { return m_disposable; }
+        rpp::utils::pointer_under_lock<TObserver>                get_observer() { return m_observer; }
+        rpp::utils::pointer_under_lock<std::queue<TObservable>>  get_queue() { return m_queue; }
+        const rpp::disposable_ptr<refcount_disposable>& get_disposable() const { return m_disposable; }
 
         std::atomic<ConcatStage>& stage() { return m_stage; }
 
@@ -102,7 +102,7 @@ namespace rpp::operators::details
         }
 
     private:
-        std::shared_ptr<refcount_disposable>                  m_disposable{};
+        rpp::disposable_ptr<refcount_disposable>     m_disposable{};
         rpp::utils::value_with_mutex<TObserver>               m_observer;
         rpp::utils::value_with_mutex<std::queue<TObservable>> m_queue;
         std::atomic<ConcatStage>                              m_stage{};
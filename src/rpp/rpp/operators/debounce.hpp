@@ -23,7 +23,7 @@ namespace rpp::operators::details
     template<rpp::constraint::observer Observer, typename Worker>
     struct debounce_state_wrapper
     {
-        std::shared_ptr<debounce_state<Observer, Worker>> state{};
+        rpp::disposable_ptr<debounce_state<Observer, Worker>> state{};
 
         bool is_disposed() const { return state->is_disposed(); }
 
@@ -112,7 +112,7 @@ namespace rpp::operators::details
     {
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        std::shared_ptr<debounce_state<Observer, Worker>> state{};
+        rpp::disposable_ptr<debounce_state<Observer, Worker>> state{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -49,7 +49,7 @@ namespace rpp::operators::details
     template<typename TState>
     struct combining_observer_strategy
     {
-        std::shared_ptr<TState> state{};
+        rpp::disposable_ptr<TState> state{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -89,8 +89,9 @@ namespace rpp::operators::details
             constexpr static bool own_current_queue = true;
         };
 
+        // observer obtains weak reference to state + all disposables of all sources
         template<rpp::details::observables::constraint::disposable_strategy Prev>
-        using updated_disposable_strategy = ::rpp::details::observables::default_disposable_strategy_selector; // TODO: sum of Prev + TObservables
+        using updated_disposable_strategy = rpp::details::observables::sum_of_disposable_strategies<typename Prev::template add<1>, rpp::details::observables::deduce_disposable_strategy_t<TObservables>...>;
 
         template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer>
         auto lift(Observer&& observer) const
@@ -104,9 +105,10 @@ namespace rpp::operators::details
         {
             using State = TState<Observer, TSelector, Type, rpp::utils::extract_observable_type_t<TObservables>...>;
 
-            const auto d     = rpp::disposable_wrapper_impl<State>::make(std::forward<Observer>(observer), selector);
-            auto       state = d.lock();
-            state->get_observer_under_lock()->set_upstream(d.as_weak());
+            auto       d     = rpp::disposable_wrapper_impl<State>::make(std::forward<Observer>(observer), selector);
+            const auto weak  = d.as_weak();
+            auto       state = std::move(d).lock();
+            state->get_observer_under_lock()->set_upstream(weak);
 
             subscribe<std::decay_t<Type>>(state, std::index_sequence_for<TObservables...>{}, observables...);
 
@@ -114,7 +116,7 @@ namespace rpp::operators::details
         }
 
         template<typename ExpectedValue, rpp::constraint::observer Observer, size_t... I>
-        static void subscribe(const std::shared_ptr<TState<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>& state, std::index_sequence<I...>, const TObservables&... observables)
+        static void subscribe(const rpp::disposable_ptr<TState<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>& state, std::index_sequence<I...>, const TObservables&... observables)
         {
             (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, TStrategy<I + 1, Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{state}));
         }
@@ -13,6 +13,7 @@
 #include <rpp/operators/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/utils/tuple.hpp>
@@ -25,6 +26,9 @@ namespace rpp::operators::details
     template<rpp::constraint::observer TObserver>
     class merge_state final
     {
+        // inner observables are added and removed all the time, so removal shouldn't depend on amount of alive inners
+        using disposable_wrapper = rpp::disposable_wrapper_impl<rpp::details::slots_composite_disposable>;
+
     public:
         merge_state(TObserver&& observer)
             : m_observer(std::move(observer))
@@ -40,11 +44,11 @@ namespace rpp::operators::details
 
         rpp::utils::pointer_under_lock<TObserver> get_observer_under_lock() { return m_observer; }
 
-        const rpp::composite_disposable_wrapper& get_disposable() const { return m_disposable; }
+        const disposable_wrapper& get_disposable() const { return m_disposable; }
 
     private:
         rpp::utils::value_with_mutex<TObserver> m_observer{};
-        rpp::composite_disposable_wrapper       m_disposable = composite_disposable_wrapper::make();
+        disposable_wrapper                      m_disposable = disposable_wrapper::make();
         std::atomic_size_t                      m_on_completed_needed{1};
     };
 
@@ -63,8 +67,7 @@ namespace rpp::operators::details
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
-            m_state->get_disposable().add(d);
-            m_disposables.push_back(d);
+            m_handles.push_back(m_state->get_disposable().add_with_handle(d));
         }
 
         bool is_disposed() const
@@ -85,16 +88,16 @@ namespace rpp::operators::details
             }
             else
             {
-                for (const auto& v : m_disposables)
+                for (const auto& handle : m_handles)
                 {
-                    m_state->get_disposable().remove(v);
+                    m_state->get_disposable().remove(handle);
                 }
             }
         }
 
     protected:
-        std::shared_ptr<merge_state<TObserver>>      m_state;
-        mutable std::vector<rpp::disposable_wrapper> m_disposables{};
+        std::shared_ptr<merge_state<TObserver>>                           m_state;
+        mutable std::vector<rpp::details::disposables::disposable_handle> m_handles{};
     };
 
     template<rpp::constraint::observer TObserver>
@@ -112,8 +112,9 @@ namespace rpp::operators::details
             using observer_strategy = on_error_resume_next_observer_strategy<TObserver, Selector>;
         };
 
+        // observer obtains disposables of original observable and then of observable returned by selector
         template<rpp::details::observables::constraint::disposable_strategy Prev>
-        using updated_disposable_strategy = rpp::details::observables::default_disposable_strategy_selector;
+        using updated_disposable_strategy = rpp::details::observables::sum_of_disposable_strategies<Prev, rpp::details::observables::deduce_disposable_strategy_t<std::invoke_result_t<Selector, std::exception_ptr>>>;
     };
 } // namespace rpp::operators::details
 
@@ -48,7 +48,7 @@ namespace rpp::operators::details
     public:
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        switch_on_next_inner_observer_strategy(const std::shared_ptr<switch_on_next_state_t<TObserver>>& state, const composite_disposable_wrapper& refcounted)
+        switch_on_next_inner_observer_strategy(const rpp::disposable_ptr<switch_on_next_state_t<TObserver>>& state, const composite_disposable_wrapper& refcounted)
             : m_state{state}
             , m_refcounted{refcounted}
         {
@@ -77,8 +77,8 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_refcounted.is_disposed(); }
 
     private:
-        std::shared_ptr<switch_on_next_state_t<TObserver>> m_state;
-        rpp::composite_disposable_wrapper                  m_refcounted;
+        rpp::disposable_ptr<switch_on_next_state_t<TObserver>> m_state;
+        rpp::composite_disposable_wrapper                               m_refcounted;
     };
 
     template<rpp::constraint::observer TObserver>
@@ -119,7 +119,7 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_this_refcount.is_disposed(); }
 
     private:
-        static std::shared_ptr<switch_on_next_state_t<TObserver>> init_state(TObserver&& observer)
+        static rpp::disposable_ptr<switch_on_next_state_t<TObserver>> init_state(TObserver&& observer)
         {
             const auto d   = disposable_wrapper_impl<switch_on_next_state_t<TObserver>>::make(std::move(observer));
             auto       ptr = d.lock();
@@ -128,9 +128,9 @@ namespace rpp::operators::details
         }
 
     private:
-        std::shared_ptr<switch_on_next_state_t<TObserver>> m_state;
-        rpp::composite_disposable_wrapper                  m_this_refcount = m_state->add_ref();
-        mutable rpp::composite_disposable_wrapper          m_last_refcount = composite_disposable_wrapper::empty();
+        rpp::disposable_ptr<switch_on_next_state_t<TObserver>> m_state;
+        rpp::composite_disposable_wrapper                               m_this_refcount = m_state->add_ref();
+        mutable rpp::composite_disposable_wrapper                       m_last_refcount = composite_disposable_wrapper::empty();
     };
 
     struct switch_on_next_t : lift_operator<switch_on_next_t>
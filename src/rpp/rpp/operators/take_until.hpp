@@ -103,7 +103,7 @@ namespace rpp::operators::details
         };
 
         template<rpp::details::observables::constraint::disposable_strategy Prev>
-        using updated_disposable_strategy = rpp::details::observables::default_disposable_strategy_selector;
+        using updated_disposable_strategy = rpp::details::observables::sum_of_disposable_strategies<Prev, rpp::details::observables::deduce_disposable_strategy_t<TObservable>>;
 
         template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer>
         auto lift(Observer&& observer) const
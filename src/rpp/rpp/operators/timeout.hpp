@@ -51,7 +51,7 @@ namespace rpp::operators::details
     template<rpp::constraint::observer TObserver, rpp::constraint::observable TFallbackObservable, rpp::details::disposables::constraint::disposable_container Container>
     struct timeout_disposable_wrapper
     {
-        std::shared_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
+        rpp::disposable_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
 
         bool is_disposed() const { return disposable->is_disposed(); }
 
@@ -66,7 +66,7 @@ namespace rpp::operators::details
     {
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        std::shared_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
+        rpp::disposable_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -114,6 +114,10 @@ namespace rpp::operators::details
             constexpr static bool own_current_queue = true;
         };
 
+        // observer obtains weak reference to state and then disposables of fallback observable
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::sum_of_disposable_strategies<rpp::details::observables::fixed_disposable_strategy_selector<1>, rpp::details::observables::deduce_disposable_strategy_t<TFallbackObservable>>;
+
         rpp::schedulers::duration                 period;
         RPP_NO_UNIQUE_ADDRESS TFallbackObservable fallback;
         RPP_NO_UNIQUE_ADDRESS TScheduler          scheduler;
@@ -163,6 +167,9 @@ namespace rpp::operators::details
             constexpr static bool own_current_queue = true;
         };
 
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
         rpp::schedulers::duration        period;
         RPP_NO_UNIQUE_ADDRESS TScheduler scheduler;
 
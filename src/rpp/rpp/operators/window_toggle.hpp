@@ -76,7 +76,7 @@ namespace rpp::operators::details
     {
         using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-        std::shared_ptr<rpp::refcount_disposable>                                                 disposable;
+        rpp::disposable_ptr<rpp::refcount_disposable>                                    disposable;
         std::shared_ptr<TState>                                                                   state;
         rpp::composite_disposable_wrapper                                                         this_disposable;
         decltype(std::declval<TState>().on_new_subject(std::declval<typename TState::Subject>())) itr;
@@ -112,8 +112,8 @@ namespace rpp::operators::details
     template<rpp::constraint::decayed_type TState>
     struct window_toggle_opening_observer_strategy
     {
-        std::shared_ptr<rpp::refcount_disposable> disposable;
-        std::shared_ptr<TState>                   state;
+        rpp::disposable_ptr<rpp::refcount_disposable> disposable;
+        std::shared_ptr<TState>                                state;
 
         template<typename T>
         void on_next(T&& v) const
@@ -182,8 +182,8 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_disposable->is_disposed(); }
 
     private:
-        std::shared_ptr<rpp::refcount_disposable> m_disposable = disposable_wrapper_impl<rpp::refcount_disposable>::make().lock();
-        std::shared_ptr<TState>                   m_state;
+        rpp::disposable_ptr<rpp::refcount_disposable> m_disposable = disposable_wrapper_impl<rpp::refcount_disposable>::make().lock();
+        std::shared_ptr<TState>                                m_state;
     };
 
     template<rpp::constraint::observable TOpeningsObservable, typename TClosingsSelectorFn>
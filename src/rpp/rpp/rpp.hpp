@@ -12,6 +12,7 @@
 
 #include <rpp/disposables.hpp>
 #include <rpp/fwd.hpp>
+#include <rpp/instrumentation.hpp>
 #include <rpp/observables.hpp>
 #include <rpp/observers.hpp>
 #include <rpp/operators.hpp>
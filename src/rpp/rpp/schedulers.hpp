@@ -23,3 +23,4 @@
 #include <rpp/schedulers/new_thread.hpp>
 #include <rpp/schedulers/run_loop.hpp>
 #include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/schedulers/work_stealing_thread_pool.hpp>
@@ -12,7 +12,11 @@
 
 #include <rpp/schedulers/fwd.hpp>
 
+#include <rpp/schedulers/details/thread_options.hpp>
 #include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/schedulers/work_stealing_thread_pool.hpp>
+
+#include <mutex>
 
 namespace rpp::schedulers
 {
@@ -20,19 +24,72 @@ namespace rpp::schedulers
      * @brief Scheduler owning static thread pool of workers and using "some" thread from this pool on `create_worker` call
      * @warning Actually it is static variable to `thread_pool` scheduler
      * @note Expected to pass to this scheduler intensive CPU bound tasks with relatevely small duration of execution (to be sure that no any thread with tasks from some other operators would be blocked on that task)
+     * @note Use `configure` before first usage to control amount of threads, their names and placement on CPUs.
+     * @note Define `RPP_COMPUTATIONAL_USE_WORK_STEALING` (or enable same CMake option) to use `rpp::schedulers::work_stealing_thread_pool` instead of `rpp::schedulers::thread_pool`. It must be same for all translation units.
      *
      * @par Examples
      * @snippet thread_pool.cpp computational
+     * @snippet thread_pool.cpp thread_pool_options
      *
      * @ingroup schedulers
      */
     class computational final
     {
+#ifdef RPP_COMPUTATIONAL_USE_WORK_STEALING
+        using pool_t = work_stealing_thread_pool;
+#else
+        using pool_t = thread_pool;
+#endif
+
     public:
+        /**
+         * @brief Sets amount of threads, their names and CPU affinity for pool of this scheduler.
+         * @warning Has effect only if called before first `create_worker` call (pool is created lazily on first use)
+         *
+         * @return true if options would be applied, false if pool is already created
+         */
+        static bool configure(thread_pool_options options)
+        {
+            auto&           config = get_config();
+            std::lock_guard lock{config.mutex};
+            if (config.is_pool_created)
+                return false;
+
+            config.options = std::move(options);
+            return true;
+        }
+
         static auto create_worker()
         {
-            static thread_pool s_tp{};
-            return s_tp.create_worker();
+            return get_pool().create_worker();
+        }
+
+    private:
+        struct config
+        {
+            std::mutex          mutex{};
+            thread_pool_options options{};
+            bool                is_pool_created{};
+        };
+
+        static config& get_config()
+        {
+            static config s_config{};
+            return s_config;
+        }
+
+        static thread_pool_options take_options()
+        {
+            auto&           config = get_config();
+            std::lock_guard lock{config.mutex};
+            config.is_pool_created = true;
+            return config.options;
+        }
+
+        static pool_t& get_pool()
+        {
+            static pool_t s_tp{take_options()};
+            return s_tp;
         }
     };
 } // namespace rpp::schedulers
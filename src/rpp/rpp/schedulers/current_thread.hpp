@@ -106,36 +106,10 @@ namespace rpp::schedulers
         {
             while (get_queue() && !get_queue()->is_empty())
             {
-                auto top = get_queue()->pop();
-                if (top->is_disposed())
-                    continue;
-
-                details::sleep_until(top->get_timepoint());
-
-                while (true)
-                {
-                    if (const auto res = top->make_advanced_call())
-                    {
-                        if (!top->is_disposed())
-                        {
-                            if (get_queue()->is_empty())
-                            {
-                                if (const auto d = std::get_if<delay_from_now>(&res->get()))
-                                {
-                                    std::this_thread::sleep_for(d->value);
-                                }
-                                else
-                                {
-                                    details::sleep_until(top->handle_advanced_call(res.value()));
-                                }
-                                continue;
-                            }
-                            const auto tp = top->handle_advanced_call(res.value());
-                            get_queue()->emplace(tp, std::move(top));
-                        }
-                    }
-                    break;
-                }
+                // schedulables of one batch observe the same "now" (if enabled)
+                [[maybe_unused]] const details::batch_now_scope now_scope{};
+                for (size_t i = 0; i < s_max_batch_size && get_queue() && !get_queue()->is_empty(); ++i)
+                    execute_top();
             }
 
             get_queue() = nullptr;
@@ -152,7 +126,7 @@ namespace rpp::schedulers
 
                 if (!get_queue())
                 {
-                    details::schedulables_queue<worker_strategy> queue{};
+                    auto& queue = get_own_queue();
                     get_queue() = &queue;
 
                     const auto timepoint = details::immediate_scheduling_while_condition<worker_strategy>(duration, is_queue_is_empty{queue}, fn, handler, args...);
@@ -186,6 +160,52 @@ namespace rpp::schedulers
         };
 
     private:
+        static constexpr size_t s_max_batch_size = 64;
+
+        static void execute_top()
+        {
+            auto top = get_queue()->pop();
+            if (top->is_disposed())
+                return;
+
+            details::sleep_until(top->get_timepoint());
+
+            while (true)
+            {
+                if (const auto res = top->make_advanced_call())
+                {
+                    if (!top->is_disposed())
+                    {
+                        if (get_queue()->is_empty())
+                        {
+                            if (const auto d = std::get_if<delay_from_now>(&res->get()))
+                            {
+                                details::sleep_for(d->value);
+                            }
+                            else
+                            {
+                                details::sleep_until(top->handle_advanced_call(res.value()));
+                            }
+                            details::batch_now_scope::refresh();
+                            continue;
+                        }
+                        const auto tp = top->handle_advanced_call(res.value());
+                        get_queue()->emplace(tp, std::move(top));
+                    }
+                }
+                break;
+            }
+        }
+
+        /**
+         * @brief Queue used by current thread when nobody else provided queue. It is the same queue for each ownership to re-use already allocated storage.
+         */
+        static details::schedulables_queue<worker_strategy>& get_own_queue()
+        {
+            thread_local details::schedulables_queue<worker_strategy> s_queue{};
+            return s_queue;
+        }
+
         class own_queue_guard
         {
         public:
@@ -193,7 +213,7 @@ namespace rpp::schedulers
                 : m_clear_on_destruction{!get_queue()}
             {
                 if (m_clear_on_destruction)
-                    get_queue() = &m_queue;
+                    get_queue() = &get_own_queue();
             }
             ~own_queue_guard()
             {
@@ -204,8 +224,7 @@ namespace rpp::schedulers
             own_queue_guard(own_queue_guard&&)      = delete;
 
         private:
-            details::schedulables_queue<worker_strategy> m_queue{};
-            bool                                         m_clear_on_destruction{};
+            bool m_clear_on_destruction{};
         };
 
     public:
@@ -0,0 +1,148 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2022 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Per-thread cache of memory blocks used to allocate schedulables without touching global heap in steady state.
+     * @details Blocks are grouped into size classes of `s_granularity` bytes. Freed block is cached in free-list of the thread where it was freed (not where it was allocated), up to `s_max_cached_blocks` blocks per size class, any other block is returned to global heap.
+     * Blocks bigger than `s_max_size` or with extended alignment are not cached at all.
+     */
+    class schedulables_pool
+    {
+        static constexpr size_t s_granularity       = 64;
+        static constexpr size_t s_size_classes      = 8;
+        static constexpr size_t s_max_size          = s_granularity * s_size_classes;
+        static constexpr size_t s_max_cached_blocks = 256;
+
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        enum class state : uint8_t
+        {
+            NotCreated,
+            Alive,
+            Destroyed
+        };
+
+        static state& get_state()
+        {
+            thread_local state s_state{state::NotCreated};
+            return s_state;
+        }
+
+        class free_lists
+        {
+        public:
+            free_lists() { get_state() = state::Alive; }
+
+            free_lists(const free_lists&) = delete;
+            free_lists(free_lists&&)      = delete;
+
+            ~free_lists() noexcept
+            {
+                get_state() = state::Destroyed;
+                for (size_t i = 0; i < s_size_classes; ++i)
+                {
+                    while (const auto block = m_heads[i])
+                    {
+                        m_heads[i] = block->next;
+                        ::operator delete(block, (i + 1) * s_granularity);
+                    }
+                }
+            }
+
+            void* pop(size_t size_class)
+            {
+                const auto block = m_heads[size_class];
+                if (!block)
+                    return nullptr;
+
+                m_heads[size_class] = block->next;
+                --m_counts[size_class];
+                return block;
+            }
+
+            bool push(void* ptr, size_t size_class)
+            {
+                if (m_counts[size_class] >= s_max_cached_blocks)
+                    return false;
+
+                m_heads[size_class] = ::new (ptr) free_block{m_heads[size_class]};
+                ++m_counts[size_class];
+                return true;
+            }
+
+        private:
+            std::array<free_block*, s_size_classes> m_heads{};
+            std::array<size_t, s_size_classes>      m_counts{};
+        };
+
+        static free_lists& get_free_lists()
+        {
+            thread_local free_lists s_lists{};
+            return s_lists;
+        }
+
+        static constexpr bool is_poolable(size_t size, size_t alignment)
+        {
+            return size <= s_max_size && alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+        }
+
+        static constexpr size_t get_size_class(size_t size)
+        {
+            return (size + s_granularity - 1) / s_granularity - 1;
+        }
+
+    public:
+        /**
+         * @brief Takes cached block of current thread suitable for provided size and alignment
+         * @return nullptr if there is no such block: `allocate_new` should be used instead
+         */
+        static void* try_reuse(size_t size, size_t alignment)
+        {
+            if (!is_poolable(size, alignment) || get_state() == state::Destroyed)
+                return nullptr;
+
+            return get_free_lists().pop(get_size_class(size));
+        }
+
+        /**
+         * @brief Allocates new block from global heap. Any block obtained via `try_reuse` or `allocate_new` should be returned via `deallocate`
+         */
+        static void* allocate_new(size_t size, size_t alignment)
+        {
+            if (!is_poolable(size, alignment))
+                return ::operator new(size, std::align_val_t{alignment});
+
+            return ::operator new((get_size_class(size) + 1) * s_granularity);
+        }
+
+        static void deallocate(void* ptr, size_t size, size_t alignment) noexcept
+        {
+            if (!is_poolable(size, alignment))
+                return ::operator delete(ptr, size, std::align_val_t{alignment});
+
+            const auto size_class = get_size_class(size);
+            if (get_state() != state::Destroyed && get_free_lists().push(ptr, size_class))
+                return;
+
+            ::operator delete(ptr, (size_class + 1) * s_granularity);
+        }
+    };
+} // namespace rpp::schedulers::details
@@ -12,6 +12,8 @@
 #include <rpp/schedulers/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/instrumentation.hpp>
+#include <rpp/schedulers/details/pool.hpp>
 #include <rpp/schedulers/details/utils.hpp>
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/tuple.hpp>
@@ -19,18 +21,24 @@
 
 #include "rpp/utils/functors.hpp"
 
-#include <condition_variable>
+#include <algorithm>
+#include <atomic>
+#include <concepts>
 #include <exception>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace rpp::schedulers::details
 {
+    class schedulables_inbox;
+
     class schedulable_base
     {
+        friend class schedulables_inbox;
+
     public:
         explicit schedulable_base(const time_point& time_point)
             : m_time_point{time_point}
@@ -77,21 +85,15 @@ namespace rpp::schedulers::details
 
         virtual void on_error(const std::exception_ptr& ep) const = 0;
 
+        /**
+         * @brief Destroys schedulable and returns its memory back to the pool
+         */
+        virtual void destroy() noexcept = 0;
+
         time_point get_timepoint() const { return m_time_point; }
 
         void set_timepoint(const time_point& timepoint) { m_time_point = timepoint; }
 
-        const std::shared_ptr<schedulable_base>& get_next() const { return m_next; }
-
-        void set_next(std::shared_ptr<schedulable_base>&& next) { m_next = std::move(next); }
-
-        void update_next(std::shared_ptr<schedulable_base>&& next)
-        {
-            if (next)
-                next->set_next(std::move(m_next));
-            m_next = std::move(next);
-        }
-
     protected:
         template<typename NowStrategy>
         auto get_advanced_call_handler() const
@@ -109,8 +111,8 @@ namespace rpp::schedulers::details
         }
 
     private:
-        std::shared_ptr<schedulable_base> m_next{};
-        time_point                        m_time_point;
+        time_point        m_time_point;
+        schedulable_base* m_next_in_inbox{};
     };
 
     template<typename NowStrategy, rpp::constraint::decayed_type Fn, rpp::schedulers::constraint::schedulable_handler Handler, rpp::constraint::decayed_type... Args>
@@ -163,45 +165,313 @@ namespace rpp::schedulers::details
 
         void on_error(const std::exception_ptr& ep) const override { m_args.template get<0>().on_error(ep); }
 
+        void destroy() noexcept override
+        {
+            void* const ptr = this;
+            this->~specific_schedulable();
+            schedulables_pool::deallocate(ptr, sizeof(specific_schedulable), alignof(specific_schedulable));
+            rpp::details::instrumentation::on_deallocated(rpp::details::instrumentation::category::schedulables, sizeof(specific_schedulable));
+        }
+
     private:
         RPP_NO_UNIQUE_ADDRESS rpp::utils::tuple<Handler, Args...> m_args;
         RPP_NO_UNIQUE_ADDRESS Fn                                  m_fn;
     };
 
-    template<typename Mutex>
-    class optional_mutex
+    struct schedulable_deleter
     {
+        void operator()(schedulable_base* ptr) const noexcept { ptr->destroy(); }
+    };
+
+    /**
+     * @brief Unique owner of schedulable. Schedulable is owned by exactly one place at a time (queue or thread executing it), so no any reference counting is needed.
+     */
+    using schedulable_ptr = std::unique_ptr<schedulable_base, schedulable_deleter>;
+
+    template<std::derived_from<schedulable_base> TSchedulable, typename... Args>
+    schedulable_ptr make_schedulable(Args&&... args)
+    {
+        void* const reused_ptr = schedulables_pool::try_reuse(sizeof(TSchedulable), alignof(TSchedulable));
+        void* const ptr        = reused_ptr ? reused_ptr : schedulables_pool::allocate_new(sizeof(TSchedulable), alignof(TSchedulable));
+        try
+        {
+            schedulable_ptr result{::new (ptr) TSchedulable(std::forward<Args>(args)...)};
+            if (reused_ptr)
+                rpp::details::instrumentation::on_reused(rpp::details::instrumentation::category::schedulables, sizeof(TSchedulable));
+            else
+                rpp::details::instrumentation::on_allocated(rpp::details::instrumentation::category::schedulables, sizeof(TSchedulable));
+            return result;
+        }
+        catch (...)
+        {
+            schedulables_pool::deallocate(ptr, sizeof(TSchedulable), alignof(TSchedulable));
+            throw;
+        }
+    }
+
+    /**
+     * @brief Entry of schedulables storage: schedulable with its key of ordering.
+     * @details Entries are ordered by time_point and then by order of insertion to keep FIFO order for schedulables with equal time_points.
+     */
+    struct schedulable_entry
+    {
+        time_point      timepoint;
+        size_t          order;
+        schedulable_ptr schedulable;
+
+        bool operator<(const schedulable_entry& other) const
+        {
+            return timepoint < other.timepoint || (timepoint == other.timepoint && order < other.order);
+        }
+    };
+
+    /**
+     * @brief Erases entries satisfying predicate keeping relative order of remaining ones. Schedulables of erased entries are moved to `removed_schedulables` instead of being destroyed.
+     * @return amount of erased entries
+     */
+    template<std::predicate<const schedulable_entry&> Pred>
+    size_t extract_entries_if(std::vector<schedulable_entry>& entries, Pred&& pred, std::vector<schedulable_ptr>& removed_schedulables)
+    {
+        size_t kept = 0;
+        for (auto& entry : entries)
+        {
+            if (pred(std::as_const(entry)))
+                removed_schedulables.push_back(std::move(entry.schedulable));
+            else
+            {
+                if (&entries[kept] != &entry)
+                    entries[kept] = std::move(entry);
+                ++kept;
+            }
+        }
+        const size_t removed = entries.size() - kept;
+        entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(kept), entries.end());
+        return removed;
+    }
+
+    /**
+     * @brief Storage of schedulables based on d-ary min-heap: O(log(n)) insertion and extraction.
+     *
+     * @tparam Arity is number of children per node (2 is binary heap, 4 is more cache-friendly for big heaps)
+     */
+    template<size_t Arity>
+    class d_ary_heap_schedulables_storage
+    {
+        static_assert(Arity >= 2);
+
     public:
-        optional_mutex() = default;
+        bool   empty() const { return m_data.empty(); }
+        size_t size() const { return m_data.size(); }
 
-        optional_mutex(Mutex* mutex)
-            : m_mutex{mutex}
+        const schedulable_entry& top() const { return m_data.front(); }
+
+        void push(schedulable_entry&& entry)
         {
+            m_data.push_back(std::move(entry));
+            sift_up(m_data.size() - 1);
         }
 
-        void lock() const
+        schedulable_entry pop()
         {
-            if (m_mutex)
-                m_mutex->lock();
+            auto result = std::move(m_data.front());
+            if (m_data.size() > 1)
+            {
+                m_data.front() = std::move(m_data.back());
+                m_data.pop_back();
+                sift_down(0);
+            }
+            else
+            {
+                m_data.pop_back();
+            }
+            return result;
+        }
+
+        template<std::predicate<const schedulable_entry&> Pred>
+        size_t remove_if(Pred&& pred, std::vector<schedulable_ptr>& removed_schedulables)
+        {
+            const size_t removed = extract_entries_if(m_data, std::forward<Pred>(pred), removed_schedulables);
+            if (removed != 0 && m_data.size() > 1)
+            {
+                // Floyd's heap construction: O(n)
+                for (size_t index = (m_data.size() - 2) / Arity + 1; index-- > 0;)
+                    sift_down(index);
+            }
+            return removed;
+        }
+
+        template<std::predicate<const schedulable_entry&> Pred>
+        size_t count_if(Pred&& pred) const
+        {
+            return static_cast<size_t>(std::count_if(m_data.begin(), m_data.end(), std::forward<Pred>(pred)));
+        }
+
+    private:
+        void sift_up(size_t index)
+        {
+            auto entry = std::move(m_data[index]);
+            while (index > 0)
+            {
+                const size_t parent = (index - 1) / Arity;
+                if (!(entry < m_data[parent]))
+                    break;
+
+                m_data[index] = std::move(m_data[parent]);
+                index         = parent;
+            }
+            m_data[index] = std::move(entry);
         }
 
-        void unlock() const
+        void sift_down(size_t index)
         {
-            if (m_mutex)
-                m_mutex->unlock();
+            const size_t size  = m_data.size();
+            auto         entry = std::move(m_data[index]);
+            while (true)
+            {
+                const size_t first_child = index * Arity + 1;
+                if (first_child >= size)
+                    break;
+
+                size_t min_child = first_child;
+                for (size_t child = first_child + 1; child < std::min(first_child + Arity, size); ++child)
+                {
+                    if (m_data[child] < m_data[min_child])
+                        min_child = child;
+                }
+
+                if (!(m_data[min_child] < entry))
+                    break;
+
+                m_data[index] = std::move(m_data[min_child]);
+                index         = min_child;
+            }
+            m_data[index] = std::move(entry);
         }
 
     private:
-        Mutex* m_mutex{};
+        std::vector<schedulable_entry> m_data{};
     };
 
-    struct shared_queue_data
+    /**
+     * @brief Storage of schedulables with O(1) fast-path for schedulables arriving in non-decreasing order of time_points.
+     * @details Most of schedulables are scheduled for "now" or "now + same delay" (`delay_from_now` re-scheduling, `interval`, `timeout`, `delay` and etc), so their time_points are monotonic. Such schedulables are appended to the sorted FIFO run, all others go to `FallbackStorage`.
+     * Sorted run is vector with moving head to re-use already allocated memory.
+     *
+     * @tparam FallbackStorage is storage used for out-of-order schedulables
+     */
+    template<typename FallbackStorage>
+    class sorted_run_schedulables_storage
     {
-        std::condition_variable_any cv{};
-        std::recursive_mutex        mutex{};
+    public:
+        bool   empty() const { return is_run_empty() && m_fallback.empty(); }
+        size_t size() const { return m_run.size() - m_head + m_fallback.size(); }
+
+        const schedulable_entry& top() const
+        {
+            if (is_run_first())
+                return m_run[m_head];
+            return m_fallback.top();
+        }
+
+        void push(schedulable_entry&& entry)
+        {
+            if (is_run_empty() || !(entry < m_run.back()))
+                m_run.push_back(std::move(entry));
+            else
+                m_fallback.push(std::move(entry));
+        }
+
+        schedulable_entry pop()
+        {
+            if (!is_run_first())
+                return m_fallback.pop();
+
+            auto result = std::move(m_run[m_head++]);
+            if (m_head == m_run.size())
+            {
+                m_run.clear();
+                m_head = 0;
+            }
+            else if (m_head * 2 >= m_run.size())
+            {
+                // amortized O(1): moving no more elements than were popped since last compaction
+                m_run.erase(m_run.begin(), m_run.begin() + static_cast<std::ptrdiff_t>(m_head));
+                m_head = 0;
+            }
+            return result;
+        }
+
+        template<std::predicate<const schedulable_entry&> Pred>
+        size_t remove_if(Pred&& pred, std::vector<schedulable_ptr>& removed_schedulables)
+        {
+            m_run.erase(m_run.begin(), m_run.begin() + static_cast<std::ptrdiff_t>(m_head));
+            m_head = 0;
+            // extraction keeps relative order, so run is still sorted
+            const size_t removed = extract_entries_if(m_run, pred, removed_schedulables);
+            return removed + m_fallback.remove_if(std::forward<Pred>(pred), removed_schedulables);
+        }
+
+        template<std::predicate<const schedulable_entry&> Pred>
+        size_t count_if(Pred&& pred) const
+        {
+            return static_cast<size_t>(std::count_if(m_run.begin() + static_cast<std::ptrdiff_t>(m_head), m_run.end(), pred)) + m_fallback.count_if(std::forward<Pred>(pred));
+        }
+
+    private:
+        bool is_run_empty() const { return m_head == m_run.size(); }
+
+        bool is_run_first() const
+        {
+            return m_fallback.empty() || (!is_run_empty() && m_run[m_head] < m_fallback.top());
+        }
+
+    private:
+        std::vector<schedulable_entry> m_run{};
+        size_t                         m_head{};
+        FallbackStorage                m_fallback{};
     };
 
-    template<typename NowStrategy>
+    using binary_heap_schedulables_storage     = d_ary_heap_schedulables_storage<2>;
+    using quaternary_heap_schedulables_storage = d_ary_heap_schedulables_storage<4>;
+    using default_schedulables_storage         = sorted_run_schedulables_storage<quaternary_heap_schedulables_storage>;
+} // namespace rpp::schedulers::details
+
+namespace rpp::schedulers::constraint
+{
+    template<typename S>
+    concept schedulables_storage = std::default_initializable<S> && std::movable<S> && requires(S& s, const S& const_s, rpp::schedulers::details::schedulable_entry&& entry, bool (*pred)(const rpp::schedulers::details::schedulable_entry&), std::vector<rpp::schedulers::details::schedulable_ptr>& removed) {
+        {
+            const_s.empty()
+        } -> std::same_as<bool>;
+        {
+            const_s.size()
+        } -> std::same_as<size_t>;
+        {
+            const_s.top()
+        } -> std::same_as<const rpp::schedulers::details::schedulable_entry&>;
+        s.push(std::move(entry));
+        {
+            s.pop()
+        } -> std::same_as<rpp::schedulers::details::schedulable_entry>;
+        {
+            s.remove_if(pred, removed)
+        } -> std::same_as<size_t>;
+        {
+            const_s.count_if(pred)
+        } -> std::same_as<size_t>;
+    };
+} // namespace rpp::schedulers::constraint
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Queue of schedulables ordered by time_point and order of insertion (FIFO for equal time_points)
+     * @details Disposed schedulables (cancelled `timeout`/`debounce`/`delay` timers and etc) are not removed by owner immediately, they are dropped only when reach the head of queue. To keep memory (and captured observers) proportional to amount of alive schedulables, queue is compacted when its size reaches threshold: all disposed schedulables are removed at once and threshold is set to twice of remaining size. So, compaction costs amortized O(1) per emplace. Removed schedulables are returned from `emplace`/`compact` to be destroyed by caller outside of its lock.
+     *
+     * @tparam NowStrategy is strategy used to calculate `now` for schedulables
+     * @tparam Storage is policy of underlying storage of schedulables
+     */
+    template<typename NowStrategy, constraint::schedulables_storage Storage = default_schedulables_storage>
     class schedulables_queue
     {
     public:
@@ -212,73 +482,155 @@ namespace rpp::schedulers::details
         schedulables_queue& operator=(const schedulables_queue& other)     = delete;
         schedulables_queue& operator=(schedulables_queue&& other) noexcept = default;
 
-        schedulables_queue(std::weak_ptr<shared_queue_data> shared_data)
-            : m_shared_data{std::move(shared_data)}
-        {
-        }
+        /**
+         * @brief Removed disposed schedulables. Destroying them releases captured state (observers, disposables and etc), so owner guarded by lock should destroy them only after unlocking.
+         */
+        using compacted_schedulables = std::vector<schedulable_ptr>;
 
+        /**
+         * @return disposed schedulables removed by compaction triggered by this emplace (empty most of the time)
+         */
         template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
-        void emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+        compacted_schedulables emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
         {
             using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
 
-            emplace_impl(std::make_shared<schedulable_type>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+            return emplace_impl(make_schedulable<schedulable_type>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
         }
 
-        void emplace(const time_point& timepoint, std::shared_ptr<schedulable_base>&& schedulable)
+        compacted_schedulables emplace(const time_point& timepoint, schedulable_ptr&& schedulable)
         {
             if (!schedulable)
-                return;
+                return {};
 
             schedulable->set_timepoint(timepoint);
-            emplace_impl(std::move(schedulable));
+            return emplace_impl(std::move(schedulable));
         }
 
-        bool is_empty() const { return !m_head; }
+        bool is_empty() const { return m_storage.empty(); }
+
+        size_t size() const { return m_storage.size(); }
+
+        schedulable_ptr pop()
+        {
+            auto result = m_storage.pop().schedulable;
+            // lower threshold back when queue shrinks to not keep threshold of some old peak forever
+            if (m_compaction_threshold > s_min_compaction_threshold && m_storage.size() * 4 < m_compaction_threshold)
+                m_compaction_threshold /= 2;
+            return result;
+        }
 
-        std::shared_ptr<schedulable_base> pop()
+        const schedulable_ptr& top() const
         {
-            return std::exchange(m_head, m_head->get_next());
+            return m_storage.top().schedulable;
         }
 
-        const std::shared_ptr<schedulable_base>& top() const
+        /**
+         * @brief Removes all disposed schedulables from queue
+         * @return removed schedulables
+         */
+        compacted_schedulables compact()
         {
-            return m_head;
+            compacted_schedulables removed{};
+            m_compacted_count += m_storage.remove_if([](const schedulable_entry& entry) { return entry.schedulable->is_disposed(); }, removed);
+            m_compaction_threshold = std::max(s_min_compaction_threshold, m_storage.size() * 2);
+            return removed;
         }
 
+        /**
+         * @brief Amount of disposed schedulables currently stored in queue and waiting for removal. O(n), intended for diagnostics.
+         */
+        size_t get_disposed_count() const
+        {
+            return m_storage.count_if([](const schedulable_entry& entry) { return entry.schedulable->is_disposed(); });
+        }
+
+        /**
+         * @brief Total amount of disposed schedulables removed by compactions during lifetime of queue
+         */
+        size_t get_compacted_count() const { return m_compacted_count; }
+
     private:
-        void emplace_impl(std::shared_ptr<schedulable_base>&& schedulable)
+        compacted_schedulables emplace_impl(schedulable_ptr&& schedulable)
+        {
+            const auto timepoint = schedulable->get_timepoint();
+            m_storage.push(schedulable_entry{timepoint, m_order++, std::move(schedulable)});
+
+            if (m_storage.size() >= m_compaction_threshold)
+                return compact();
+            return {};
+        }
+
+    private:
+        static constexpr size_t s_min_compaction_threshold = 64;
+
+        Storage m_storage{};
+        size_t  m_order{};
+        size_t  m_compaction_threshold = s_min_compaction_threshold;
+        size_t  m_compacted_count{};
+    };
+
+    /**
+     * @brief Lock-free multi-producer single-consumer inbox of schedulables.
+     * @details Producers push schedulables from any thread without any locks, consumer takes all of them at once in order of pushing and moves to own `schedulables_queue`. Schedulables are linked intrusively, so no any extra allocations.
+     */
+    class schedulables_inbox
+    {
+    public:
+        schedulables_inbox() = default;
+
+        schedulables_inbox(const schedulables_inbox&) = delete;
+        schedulables_inbox(schedulables_inbox&&)      = delete;
+
+        ~schedulables_inbox() noexcept
         {
-            // needed in case of new_thread and current_thread shares same queue
-            const auto                       s = m_shared_data.lock();
-            const rpp::utils::finally_action _{[&] {
-                if (s)
-                    s->cv.notify_one();
-            }};
+            drain([](schedulable_ptr&&) {});
+        }
 
-            optional_mutex<std::recursive_mutex> mutex{s ? &s->mutex : nullptr};
-            std::lock_guard                      lock{mutex};
+        template<typename NowStrategy, rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
 
-            if (!m_head || schedulable->get_timepoint() < m_head->get_timepoint())
+            push(make_schedulable<schedulable_type>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+        }
+
+        void push(schedulable_ptr&& schedulable)
+        {
+            schedulable_base* const node = schedulable.release();
+            node->m_next_in_inbox        = m_head.load(std::memory_order_relaxed);
+            while (!m_head.compare_exchange_weak(node->m_next_in_inbox, node, std::memory_order_seq_cst, std::memory_order_relaxed))
             {
-                schedulable->set_next(std::move(m_head));
-                m_head = std::move(schedulable);
-                return;
             }
+        }
 
-            schedulable_base* current = m_head.get();
-            while (const auto& next = current->get_next())
+        /**
+         * @brief Takes all pushed schedulables and passes them to `fn` in order of pushing. Expected to be called only by consumer thread
+         */
+        template<std::invocable<schedulable_ptr&&> Fn>
+        void drain(Fn&& fn)
+        {
+            schedulable_base* reversed{};
+            for (auto* node = m_head.exchange(nullptr, std::memory_order_acquire); node;)
             {
-                if (schedulable->get_timepoint() < next->get_timepoint())
-                    break;
-                current = next.get();
+                auto* next            = node->m_next_in_inbox;
+                node->m_next_in_inbox = reversed;
+                reversed              = node;
+                node                  = next;
             }
 
-            current->update_next(std::move(schedulable));
+            while (reversed)
+            {
+                auto* next                = reversed->m_next_in_inbox;
+                reversed->m_next_in_inbox = nullptr;
+                fn(schedulable_ptr{reversed});
+                reversed = next;
+            }
         }
 
+        bool is_empty() const { return m_head.load(std::memory_order_seq_cst) == nullptr; }
+
     private:
-        std::shared_ptr<schedulable_base> m_head{};
-        std::weak_ptr<shared_queue_data>  m_shared_data{};
+        std::atomic<schedulable_base*> m_head{};
     };
 } // namespace rpp::schedulers::details
@@ -0,0 +1,93 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#elif defined(__APPLE__)
+    #include <pthread.h>
+#endif
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Options of thread created by scheduler
+     */
+    struct thread_options
+    {
+        // name of thread visible in debuggers/profilers. Truncated to 15 symbols on Linux. Empty - keep default one
+        std::string name{};
+        // indexes of CPUs thread is allowed to run on. Applied only on Linux. Empty - no restrictions
+        std::vector<size_t> cpus{};
+        // how late delayed schedulable is allowed to be executed. Sleeping thread wakes up at `timepoint + timer_slack` of earliest schedulable and executes everything due at that moment, so timers close to each other share one wake-up
+        duration timer_slack{};
+    };
+
+    /**
+     * @brief Options of thread pools
+     */
+    struct thread_pool_options
+    {
+        size_t threads_count = std::thread::hardware_concurrency();
+        // name of threads, thread with index `i` is named as `{name}-{i}`. Empty - keep default one
+        std::string name{};
+        // thread with index `i` is allowed to run only on CPUs from `affinity[i % affinity.size()]`. Empty - no restrictions
+        // For example, `{{0}, {1}, {2}, {3}}` pins each thread to its own core, while `{utils::get_numa_node_cpus(0)}` (from <rpp/schedulers/numa.hpp>) keeps all threads on first NUMA node.
+        std::vector<std::vector<size_t>> affinity{};
+        // see `thread_options::timer_slack`
+        duration timer_slack{};
+
+        thread_options get_thread_options(size_t index) const
+        {
+            return thread_options{.name        = name.empty() ? std::string{} : name + "-" + std::to_string(index),
+                                  .cpus        = affinity.empty() ? std::vector<size_t>{} : affinity[index % affinity.size()],
+                                  .timer_slack = timer_slack};
+        }
+    };
+} // namespace rpp::schedulers
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Applies options to calling thread. It is best effort: failures (not enough rights, non existing CPU) are ignored.
+     */
+    inline void apply_to_current_thread(const thread_options& options)
+    {
+#if defined(__linux__)
+        if (!options.name.empty())
+            ::pthread_setname_np(::pthread_self(), options.name.substr(0, 15).c_str());
+
+        if (!options.cpus.empty())
+        {
+            cpu_set_t set{};
+            CPU_ZERO(&set);
+            for (const auto cpu : options.cpus)
+            {
+                if (cpu < CPU_SETSIZE)
+                    CPU_SET(cpu, &set);
+            }
+            ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+        }
+#elif defined(__APPLE__)
+        if (!options.name.empty())
+            ::pthread_setname_np(options.name.c_str());
+#else
+        static_cast<void>(options);
+#endif
+    }
+} // namespace rpp::schedulers::details
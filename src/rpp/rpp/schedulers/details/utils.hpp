@@ -11,17 +11,159 @@
 
 #include <rpp/schedulers/fwd.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <ctime>
 #include <exception>
 #include <optional>
 #include <thread>
 
+#if defined(_M_X64) || defined(_M_IX86)
+    #include <intrin.h>
+#endif
+
 namespace rpp::schedulers::details
 {
     inline thread_local time_point s_last_now_time{};
 
-    inline rpp::schedulers::time_point now()
+    struct now_cache
     {
+        bool       is_active{};
+        bool       has_value{};
+        time_point value{};
+    };
+
+    inline thread_local now_cache s_now_cache{};
+
+    /**
+     * @brief Reads CLOCK_MONOTONIC_COARSE where it is available: it is few times cheaper than steady_clock, but its resolution is kernel tick (1-4ms). Falls back to steady_clock otherwise.
+     * @details On Linux steady_clock is CLOCK_MONOTONIC, so both clocks have the same epoch and values can be mixed.
+     */
+    inline time_point coarse_now()
+    {
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+        timespec ts{};
+        ::clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+        return time_point{std::chrono::duration_cast<duration>(std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec})};
+#else
+        return clock_type::now();
+#endif
+    }
+
+    inline time_point read_clock()
+    {
+#ifdef RPP_SCHEDULERS_COARSE_CLOCK
+        // coarse clock lags behind steady_clock, so never report time earlier than already observed one
+        return s_last_now_time = std::max(coarse_now(), s_last_now_time);
+#else
         return s_last_now_time = clock_type::now();
+#endif
+    }
+
+    inline rpp::schedulers::time_point now()
+    {
+        if (!s_now_cache.is_active)
+            return read_clock();
+
+        if (!s_now_cache.has_value)
+        {
+            s_now_cache.value     = read_clock();
+            s_now_cache.has_value = true;
+        }
+        return s_now_cache.value;
+    }
+
+    /**
+     * @brief Remembers that steady_clock already reached `timepoint` (for example, timed wait expired), so next `now()` never reports earlier time and cached value is refreshed
+     */
+    inline void advance_now_to(time_point timepoint)
+    {
+        s_last_now_time       = std::max(s_last_now_time, timepoint);
+        s_now_cache.has_value = false;
+    }
+
+    /**
+     * @brief While alive, `now()` reads clock only once and returns the same value till end of scope or till thread sleeps via `sleep_for`/`sleep_until` (or reports elapsed wait via `advance_now_to`).
+     * @details Used by loops of schedulers around execution of one batch of schedulables: all schedulables of batch see the same "now". Nested scopes are allowed.
+     */
+    class cached_now_scope
+    {
+    public:
+        cached_now_scope()
+            : m_was_active{s_now_cache.is_active}
+        {
+            s_now_cache.is_active = true;
+            s_now_cache.has_value = false;
+        }
+
+        ~cached_now_scope() noexcept
+        {
+            s_now_cache.is_active = m_was_active;
+            s_now_cache.has_value = false;
+        }
+
+        cached_now_scope(const cached_now_scope&) = delete;
+        cached_now_scope(cached_now_scope&&)      = delete;
+
+        /**
+         * @brief Next `now()` reads clock again
+         */
+        static void refresh() { s_now_cache.has_value = false; }
+
+    private:
+        bool m_was_active;
+    };
+
+    struct no_cached_now_scope
+    {
+        static void refresh() {}
+    };
+
+    /**
+     * @brief Scope opened by loops of schedulers per batch of schedulables. Caches "now" only when `RPP_SCHEDULERS_CACHED_NOW` is defined.
+     */
+#ifdef RPP_SCHEDULERS_CACHED_NOW
+    using batch_now_scope = cached_now_scope;
+#else
+    using batch_now_scope = no_cached_now_scope;
+#endif
+
+    inline void cpu_relax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(_M_X64) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    /**
+     * @brief Spins and yields according to `strategy` till `predicate` becomes true
+     * @return true if predicate became true, false if thread should park
+     */
+    inline bool spin_wait(const idle_strategy& strategy, const std::predicate auto& predicate)
+    {
+        for (size_t i = 0; i < strategy.spin_count; ++i)
+        {
+            if (predicate())
+                return true;
+            cpu_relax();
+        }
+        for (size_t i = 0; i < strategy.yield_count; ++i)
+        {
+            if (predicate())
+                return true;
+            std::this_thread::yield();
+        }
+        return false;
+    }
+
+    inline void sleep_for(const duration duration)
+    {
+        std::this_thread::sleep_for(duration);
+        s_now_cache.has_value = false;
     }
 
     inline bool sleep_until(const time_point timepoint)
@@ -31,7 +173,7 @@ namespace rpp::schedulers::details
 
         const auto now = clock_type::now();
         std::this_thread::sleep_for(timepoint - now);
-        details::s_last_now_time = std::max(now, timepoint);
+        details::advance_now_to(std::max(now, timepoint));
         return timepoint > now;
     }
 
@@ -90,7 +232,7 @@ namespace rpp::schedulers::details
 
             if (duration > duration::zero())
             {
-                std::this_thread::sleep_for(duration);
+                details::sleep_for(duration);
 
                 if (handler.is_disposed())
                     return std::nullopt;
@@ -134,7 +276,7 @@ namespace rpp::schedulers::details
             {
                 if (duration > duration::zero())
                 {
-                    std::this_thread::sleep_for(duration);
+                    details::sleep_for(duration);
 
                     if (handler.is_disposed())
                         return std::nullopt;
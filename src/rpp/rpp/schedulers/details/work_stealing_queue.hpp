@@ -0,0 +1,76 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Bounded lock-free FIFO queue of pointers with single producer (owner thread) and multiple consumers (owner thread and thieves).
+     * @details Owner pushes to the tail, while owner and thieves pop from the head via CAS. Slot can't be overwritten before it is consumed due to producer never overtakes head by more than `Capacity`.
+     *
+     * @tparam T type of pointed values
+     * @tparam Capacity max amount of stored pointers, power of 2
+     */
+    template<typename T, size_t Capacity>
+        requires ((Capacity & (Capacity - 1)) == 0)
+    class work_stealing_queue
+    {
+    public:
+        work_stealing_queue() = default;
+
+        work_stealing_queue(const work_stealing_queue&) = delete;
+        work_stealing_queue(work_stealing_queue&&)      = delete;
+
+        /**
+         * @brief Push value to the tail of queue. Expected to be called only by owner thread
+         * @return false if queue is full
+         */
+        bool push(T* value) noexcept
+        {
+            const auto tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) >= Capacity)
+                return false;
+
+            m_buffer[tail & s_mask].store(value, std::memory_order_relaxed);
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Pop value from the head of queue. Can be called from any thread
+         * @return nullptr if queue is empty
+         */
+        T* pop() noexcept
+        {
+            auto head = m_head.load(std::memory_order_acquire);
+            while (head < m_tail.load(std::memory_order_acquire))
+            {
+                const auto value = m_buffer[head & s_mask].load(std::memory_order_relaxed);
+                if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+                    return value;
+            }
+            return nullptr;
+        }
+
+        bool empty() const noexcept { return m_head.load(std::memory_order_seq_cst) >= m_tail.load(std::memory_order_seq_cst); }
+
+    private:
+        static constexpr uint64_t s_mask = Capacity - 1;
+
+        std::array<std::atomic<T*>, Capacity> m_buffer{};
+        alignas(64) std::atomic<uint64_t> m_head{};
+        alignas(64) std::atomic<uint64_t> m_tail{};
+    };
+} // namespace rpp::schedulers::details
@@ -15,6 +15,7 @@
 #include <rpp/utils/constraints.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <optional>
 
 namespace rpp::schedulers
@@ -79,6 +80,17 @@ namespace rpp::schedulers
     using optional_delay_from_now            = std::optional<delay_from_now>;
     using optional_delay_from_this_timepoint = std::optional<delay_from_this_timepoint>;
     using optional_delay_to                  = std::optional<delay_to>;
+
+    /**
+     * @brief What thread of scheduler does when it has nothing to execute: busy-spins `spin_count` iterations, then yields `yield_count` times and only then parks (sleeps on condition variable).
+     *
+     * @details Waking up of parked thread costs tens of microseconds, while spinning thread sees new schedulable almost immediately, but burns CPU while waiting. Default one parks immediately.
+     */
+    struct idle_strategy
+    {
+        size_t spin_count{};
+        size_t yield_count{};
+    };
 } // namespace rpp::schedulers
 
 namespace rpp::schedulers::details
@@ -159,8 +171,10 @@ namespace rpp::schedulers
     class immediate;
     class current_thread;
     class new_thread;
+    class configured_new_thread;
     class run_loop;
     class thread_pool;
+    class work_stealing_thread_pool;
     class computational;
 
     namespace defaults
@@ -12,12 +12,17 @@
 
 #include <rpp/disposables/details/base_disposable.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/thread_options.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <vector>
 
 namespace rpp::schedulers
 {
@@ -32,7 +37,11 @@ namespace rpp::schedulers
         class state_t final
         {
         public:
-            state_t() = default;
+            state_t(size_t max_batch_size, idle_strategy idle, const thread_options& options)
+                : m_state{std::make_shared<queue_data>(max_batch_size, idle)}
+                , m_thread{&data_thread, m_state, options}
+            {
+            }
 
             ~state_t() noexcept
             {
@@ -41,7 +50,7 @@ namespace rpp::schedulers
 
                 {
                     std::lock_guard lock{m_state->mutex};
-                    m_state->is_stoping = true;
+                    m_state->is_stopping.store(true, std::memory_order_seq_cst);
                 }
                 m_state->cv.notify_all();
                 m_thread.detach();
@@ -50,85 +59,174 @@ namespace rpp::schedulers
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point time_point, Fn&& fn, Handler&& handler, Args&&... args)
             {
-                m_state->queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
-                m_state->has_fresh_data.store(true);
+                m_state->inbox.template emplace<current_thread::worker_strategy>(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+
+                // thread is awake, so it would see new schedulable by itself
+                if (!m_state->is_parked.load(std::memory_order_seq_cst))
+                    return;
+
+                {
+                    std::lock_guard lock{m_state->mutex};
+                }
+                m_state->cv.notify_one();
             }
 
         private:
-            struct queue_data : public details::shared_queue_data
+            struct queue_data
             {
+                queue_data(size_t max_batch_size, idle_strategy idle)
+                    : max_batch_size{std::max<size_t>(max_batch_size, 1)}
+                    , idle{idle}
+                {
+                }
+
+                const size_t        max_batch_size;
+                const idle_strategy idle;
+
+                // accessed only by thread of this worker
                 details::schedulables_queue<current_thread::worker_strategy> queue{};
-                bool                                                         is_stoping{};
-                std::atomic_bool                                             has_fresh_data{false};
+                // any thread pushes here without locks, thread of this worker moves it to queue
+                details::schedulables_inbox inbox{};
+
+                std::mutex              mutex{};
+                std::condition_variable cv{};
+                std::atomic_bool        is_parked{};
+                std::atomic_bool        is_stopping{};
+
+                void drain_inbox()
+                {
+                    inbox.drain([this](details::schedulable_ptr&& schedulable) {
+                        const auto tp = schedulable->get_timepoint();
+                        queue.emplace(tp, std::move(schedulable));
+                    });
+                }
+
+                /**
+                 * @brief Moves up to `max_batch_size` ready schedulables from queue to `batch` reading clock at most once. Disposed schedulables are dropped on the way.
+                 */
+                void pop_ready_batch(std::vector<details::schedulable_ptr>& batch)
+                {
+                    auto now        = details::s_last_now_time;
+                    bool clock_read = false;
+                    while (batch.size() < max_batch_size && !queue.is_empty())
+                    {
+                        if (queue.top()->is_disposed())
+                        {
+                            queue.pop();
+                            continue;
+                        }
+
+                        if (queue.top()->get_timepoint() > now)
+                        {
+                            if (clock_read)
+                                break;
+
+                            now        = worker_strategy::now();
+                            clock_read = true;
+                            continue;
+                        }
+
+                        batch.push_back(queue.pop());
+                    }
+                }
+
+                /**
+                 * @brief Sleeps till new schedulable, stopping or provided timepoint. Producers notify `cv` only when thread is parked.
+                 * @details Stopping wakes thread only when queue is empty: already queued delayed schedulables are still executed at their timepoints, so there is no reason to spin till them.
+                 */
+                void park(const std::optional<time_point>& timepoint)
+                {
+                    const auto should_wake = [this, &timepoint] { return !inbox.is_empty() || (!timepoint && is_stopping.load(std::memory_order_seq_cst)); };
+                    if (details::spin_wait(idle, should_wake))
+                        return;
+
+                    std::unique_lock lock{mutex};
+                    is_parked.store(true, std::memory_order_seq_cst);
+                    if (timepoint)
+                    {
+                        if (!cv.wait_until(lock, timepoint.value(), should_wake))
+                            details::advance_now_to(timepoint.value());
+                    }
+                    else
+                        cv.wait(lock, should_wake);
+                    is_parked.store(false, std::memory_order_relaxed);
+                }
             };
 
-            static void data_thread(std::shared_ptr<queue_data> state)
+            static void data_thread(std::shared_ptr<queue_data> state, thread_options options)
             {
+                details::apply_to_current_thread(options);
                 current_thread::get_queue() = &state->queue;
 
+                std::vector<details::schedulable_ptr> batch{};
+                batch.reserve(state->max_batch_size);
+
                 while (true)
                 {
-                    std::unique_lock lock{state->mutex};
-                    if (state->queue.is_empty() && state->is_stoping)
-                        break;
-
-                    state->cv.wait(lock, [&] { return !state->queue.is_empty() || state->is_stoping; });
+                    state->drain_inbox();
 
                     if (state->queue.is_empty())
-                        break;
-
-                    if (state->queue.top()->is_disposed())
                     {
-                        state->queue.pop();
+                        if (state->is_stopping.load(std::memory_order_seq_cst) && state->inbox.is_empty())
+                            break;
+
+                        state->park({});
                         continue;
                     }
 
-                    if (details::s_last_now_time < state->queue.top()->get_timepoint())
                     {
-                        if (const auto now = worker_strategy::now(); now < state->queue.top()->get_timepoint())
-                        {
-                            state->cv.wait_for(lock, state->queue.top()->get_timepoint() - now, [&] { return state->queue.top()->is_disposed() || worker_strategy::now() >= state->queue.top()->get_timepoint(); });
-                            continue;
-                        }
-                    }
-
-                    auto top = state->queue.pop();
-                    state->has_fresh_data.store(!state->queue.is_empty());
-                    lock.unlock();
+                        // all schedulables of batch observe the same "now" (if enabled)
+                        details::batch_now_scope now_scope{};
 
-                    while (true)
-                    {
-                        if (const auto res = top->make_advanced_call())
+                        state->pop_ready_batch(batch);
+                        for (size_t i = 0; i < batch.size(); ++i)
                         {
-                            if (!top->is_disposed())
+                            auto& top = batch[i];
+                            // previous schedulable of batch could dispose this one
+                            while (!top->is_disposed())
                             {
-                                if (res->can_run_immediately() && !state->has_fresh_data.load())
-                                    continue;
+                                if (const auto res = top->make_advanced_call())
+                                {
+                                    if (!top->is_disposed())
+                                    {
+                                        if (res->can_run_immediately() && i + 1 == batch.size() && state->queue.is_empty() && state->inbox.is_empty())
+                                        {
+                                            now_scope.refresh();
+                                            continue;
+                                        }
 
-                                const auto tp = top->handle_advanced_call(res.value());
-                                state->queue.emplace(tp, std::move(top));
+                                        const auto tp = top->handle_advanced_call(res.value());
+                                        state->queue.emplace(tp, std::move(top));
+                                    }
+                                }
+                                break;
                             }
+                            top.reset();
                         }
-                        break;
                     }
+
+                    if (!batch.empty())
+                        batch.clear();
+                    else if (!state->queue.is_empty())
+                        state->park(state->queue.top()->get_timepoint() + options.timer_slack);
                 }
 
                 current_thread::get_queue() = nullptr;
             }
 
         private:
-            std::shared_ptr<queue_data> m_state = std::make_shared<queue_data>();
-
-            RPP_CALL_DURING_CONSTRUCTION(m_state->queue = details::schedulables_queue<current_thread::worker_strategy>(m_state));
-
-            std::thread m_thread{&data_thread, m_state};
+            std::shared_ptr<queue_data> m_state;
+            std::thread                 m_thread;
         };
 
     public:
         class worker_strategy
         {
         public:
-            worker_strategy() = default;
+            worker_strategy(size_t max_batch_size, idle_strategy idle, const thread_options& options)
+                : m_state{std::make_shared<state_t>(max_batch_size, idle, options)}
+            {
+            }
 
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
@@ -139,12 +237,67 @@ namespace rpp::schedulers
             static rpp::schedulers::time_point now() { return details::now(); }
 
         private:
-            std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
+            std::shared_ptr<state_t> m_state;
         };
 
+        /**
+         * @brief Default amount of ready schedulables which thread of worker pulls from its queue at once before executing them
+         */
+        static constexpr size_t s_default_max_batch_size = 64;
+
         static rpp::schedulers::worker<worker_strategy> create_worker()
         {
-            return rpp::schedulers::worker<worker_strategy>{};
+            return create_worker(s_default_max_batch_size);
         }
+
+        /**
+         * @param max_batch_size max amount of ready schedulables executed by thread of worker per one pass over queue (one clock read per pass)
+         * @param idle what thread of worker does when it has nothing to execute before parking
+         * @param options name, CPU affinity and timer slack of thread of worker
+         */
+        static rpp::schedulers::worker<worker_strategy> create_worker(size_t max_batch_size, idle_strategy idle = {}, const thread_options& options = {})
+        {
+            return rpp::schedulers::worker<worker_strategy>{max_batch_size, idle, options};
+        }
+    };
+
+    /**
+     * @brief Same as rpp::schedulers::new_thread, but keeps configuration of workers inside, so it can be passed to operators expecting scheduler
+     * @ingroup schedulers
+     */
+    class configured_new_thread
+    {
+    public:
+        /**
+         * @param max_batch_size max amount of ready schedulables executed by thread of worker per one pass over queue (one clock read per pass)
+         * @param idle what thread of worker does when it has nothing to execute before parking
+         * @param options name, CPU affinity and timer slack of thread of each worker
+         */
+        explicit configured_new_thread(size_t max_batch_size, idle_strategy idle = {}, thread_options options = {})
+            : m_max_batch_size{max_batch_size}
+            , m_idle{idle}
+            , m_options{std::move(options)}
+        {
+        }
+
+        explicit configured_new_thread(idle_strategy idle)
+            : m_idle{idle}
+        {
+        }
+
+        explicit configured_new_thread(thread_options options)
+            : m_options{std::move(options)}
+        {
+        }
+
+        rpp::schedulers::worker<new_thread::worker_strategy> create_worker() const
+        {
+            return new_thread::create_worker(m_max_batch_size, m_idle, m_options);
+        }
+
+    private:
+        size_t         m_max_batch_size = new_thread::s_default_max_batch_size;
+        idle_strategy  m_idle{};
+        thread_options m_options{};
     };
 } // namespace rpp::schedulers
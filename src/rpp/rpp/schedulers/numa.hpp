@@ -0,0 +1,49 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace rpp::schedulers::utils
+{
+    /**
+     * @brief Indexes of CPUs belonging to NUMA node. Read from sysfs on Linux, empty on other platforms or if there is no such node
+     * @details Intended to be used with `thread_pool_options::affinity`. This header is not included by `<rpp/schedulers.hpp>`, include it explicitly.
+     */
+    inline std::vector<size_t> get_numa_node_cpus(size_t node)
+    {
+        std::vector<size_t> cpus{};
+#if defined(__linux__)
+        // format is like "0-3,8-11,16"
+        std::ifstream file{"/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"};
+        size_t        first{};
+        while (file >> first)
+        {
+            size_t last = first;
+            if (file.peek() == '-')
+            {
+                file.get();
+                file >> last;
+            }
+            for (size_t cpu = first; cpu <= last; ++cpu)
+                cpus.push_back(cpu);
+
+            if (file.peek() == ',')
+                file.get();
+        }
+#else
+        static_cast<void>(node);
+#endif
+        return cpus;
+    }
+} // namespace rpp::schedulers::utils
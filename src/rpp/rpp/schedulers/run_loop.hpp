@@ -19,6 +19,12 @@
 #include <rpp/schedulers/details/worker.hpp>
 #include <rpp/utils/functors.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 namespace rpp::schedulers
 {
     /**
@@ -34,6 +40,13 @@ namespace rpp::schedulers
         class state_t final : public rpp::details::base_disposable
         {
         public:
+            state_t(size_t max_batch_size, idle_strategy idle, duration timer_slack)
+                : m_max_batch_size{std::max<size_t>(max_batch_size, 1)}
+                , m_idle{idle}
+                , m_timer_slack{timer_slack}
+            {
+            }
+
             ~state_t() noexcept override { dispose(); }
 
             template<typename... Args>
@@ -42,15 +55,24 @@ namespace rpp::schedulers
                 if (is_disposed())
                     return;
 
+                // destroyed after unlocking: destructors of schedulables can schedule to this run_loop again
+                typename decltype(m_queue)::compacted_schedulables compacted{};
                 {
                     std::lock_guard lock{m_mutex};
-                    m_queue.emplace(timepoint, std::forward<Args>(args)...);
+                    compacted = m_queue.emplace(timepoint, std::forward<Args>(args)...);
+                    m_has_schedulables.store(true, std::memory_order_release);
                 }
                 m_cv.notify_one();
             }
 
-            std::shared_ptr<details::schedulable_base> pop(bool wait)
+            /**
+             * @brief Moves up to `max_batch_size` ready schedulables to `batch` under single lock and single clock read. Waits for any ready schedulable if `wait` is true
+             */
+            void pop_batch(bool wait, std::vector<details::schedulable_ptr>& batch)
             {
+                if (wait)
+                    details::spin_wait(m_idle, [this] { return is_disposed() || m_has_schedulables.load(std::memory_order_acquire); });
+
                 while (!is_disposed())
                 {
                     std::unique_lock lock{m_mutex};
@@ -60,15 +82,18 @@ namespace rpp::schedulers
                         break;
 
                     const auto now = worker_strategy::now();
-                    if (is_any_ready_schedulable_unsafe(now))
-                        return m_queue.pop();
+                    while (batch.size() < m_max_batch_size && is_any_ready_schedulable_unsafe(now))
+                        batch.push_back(m_queue.pop());
+                    m_has_schedulables.store(!m_queue.is_empty(), std::memory_order_relaxed);
 
-                    if (!wait)
+                    if (!batch.empty() || !wait)
                         break;
 
-                    m_cv.wait_for(lock, m_queue.top()->get_timepoint() - now, [&]() { return is_disposed() || !m_queue.is_empty() || m_queue.top()->get_timepoint() <= worker_strategy::now(); });
+                    // wake up earlier only if something new became first
+                    const auto timepoint = m_queue.top()->get_timepoint();
+                    if (!m_cv.wait_until(lock, timepoint + m_timer_slack, [&]() { return is_disposed() || m_queue.is_empty() || m_queue.top()->get_timepoint() < timepoint; }))
+                        details::advance_now_to(timepoint + m_timer_slack);
                 }
-                return {};
             }
 
             bool is_any_ready_schedulable()
@@ -94,15 +119,21 @@ namespace rpp::schedulers
                 {
                     std::lock_guard lock{m_mutex};
                     m_queue = details::schedulables_queue<worker_strategy>{};
+                    m_has_schedulables.store(false, std::memory_order_relaxed);
                 }
                 m_cv.notify_one();
             }
 
         private:
+            const size_t                                 m_max_batch_size;
+            const idle_strategy                          m_idle;
+            const duration                               m_timer_slack;
             std::mutex                                   m_mutex{};
             details::schedulables_queue<worker_strategy> m_queue{};
 
             std::condition_variable m_cv{};
+            // mirrors `!m_queue.is_empty()` to let idle thread spin without lock
+            std::atomic_bool m_has_schedulables{};
         };
 
         class worker_strategy
@@ -127,6 +158,23 @@ namespace rpp::schedulers
         };
 
     public:
+        run_loop() = default;
+
+        /**
+         * @param max_batch_size max amount of ready schedulables pulled from queue under single lock and executed by one `dispatch`/`dispatch_if_ready` call. By default it is 1: each call dispatches single schedulable.
+         * @param idle what `dispatch` does while queue is empty before sleeping on condition variable
+         * @param timer_slack how late delayed schedulable is allowed to be executed by `dispatch`: it sleeps till `timepoint + timer_slack` of earliest schedulable, so timers close to each other share one wake-up
+         */
+        explicit run_loop(size_t max_batch_size, idle_strategy idle = {}, duration timer_slack = {})
+            : m_state{std::make_shared<state_t>(max_batch_size, idle, timer_slack)}
+        {
+        }
+
+        explicit run_loop(idle_strategy idle)
+            : m_state{std::make_shared<state_t>(1, idle, duration{})}
+        {
+        }
+
         bool is_empty() const
         {
             return m_state->is_empty();
@@ -155,17 +203,28 @@ namespace rpp::schedulers
     private:
         void dispatch_impl(bool wait) const
         {
-            if (auto top = m_state->pop(wait))
-            {
-                if (top->is_disposed())
-                    return;
+            // buffer is reused between calls, nested dispatch (from schedulable) just gets an empty one
+            thread_local std::vector<details::schedulable_ptr> s_batch{};
+            auto                                               batch = std::move(s_batch);
 
-                if (const auto timepoint = (*top)())
-                    m_state->emplace_and_notify(timepoint.value(), std::move(top));
+            m_state->pop_batch(wait, batch);
+
+            // all schedulables of batch observe the same "now" (if enabled)
+            [[maybe_unused]] const details::batch_now_scope now_scope{};
+            for (auto& top : batch)
+            {
+                if (!top->is_disposed())
+                {
+                    if (const auto timepoint = (*top)())
+                        m_state->emplace_and_notify(timepoint.value(), std::move(top));
+                }
+                top.reset();
             }
+            batch.clear();
+            s_batch = std::move(batch);
         }
 
     private:
-        std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
+        std::shared_ptr<state_t> m_state = std::make_shared<state_t>(1, idle_strategy{}, duration{});
     };
 } // namespace rpp::schedulers
@@ -40,8 +40,7 @@ namespace rpp::schedulers
                     if (queue.top()->get_timepoint() > s_current_time)
                         return;
 
-                    auto fn = queue.top();
-                    queue.pop();
+                    auto fn = queue.pop();
 
                     if (fn->is_disposed())
                         continue;
@@ -12,6 +12,7 @@
 
 #include <rpp/schedulers/fwd.hpp>
 
+#include <rpp/schedulers/details/thread_options.hpp>
 #include <rpp/schedulers/new_thread.hpp>
 
 #include <vector>
@@ -24,6 +25,7 @@ namespace rpp::schedulers
      *
      * @par Examples
      * @snippet thread_pool.cpp thread_pool
+     * @snippet thread_pool.cpp thread_pool_options
      *
      * @ingroup schedulers
      */
@@ -59,7 +61,15 @@ namespace rpp::schedulers
 
     public:
         explicit thread_pool(size_t threads_count = std::thread::hardware_concurrency())
-            : m_state{std::make_shared<state>(threads_count)}
+            : thread_pool{thread_pool_options{.threads_count = threads_count}}
+        {
+        }
+
+        /**
+         * @param options amount of threads, their names and CPU affinity
+         */
+        explicit thread_pool(const thread_pool_options& options)
+            : m_state{std::make_shared<state>(options)}
         {
         }
 
@@ -72,12 +82,12 @@ namespace rpp::schedulers
         class state
         {
         public:
-            explicit state(size_t threads_count)
+            explicit state(const thread_pool_options& options)
             {
-                threads_count = std::max(size_t{1}, threads_count);
+                const auto threads_count = std::max(size_t{1}, options.threads_count);
                 m_workers.reserve(threads_count);
                 for (size_t i = 0; i < threads_count; ++i)
-                    m_workers.emplace_back(new_thread::create_worker());
+                    m_workers.emplace_back(new_thread::create_worker(new_thread::s_default_max_batch_size, {}, options.get_thread_options(i)));
             }
 
             const original_worker& get() { return m_workers[m_index++ % m_workers.size()]; }
@@ -0,0 +1,526 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/thread_options.hpp>
+#include <rpp/schedulers/details/utils.hpp>
+#include <rpp/schedulers/details/work_stealing_queue.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler owning thread pool where any idle thread can pick up ready work of any worker.
+     * @warning Expected to use this scheduler as local variable to share same threads between different operators or as static variable
+     *
+     * @details Each `create_worker` call creates new "strand" - virtual serial queue of schedulables over the pool, so worker keeps same guarantees as any other worker: schedulables are executed one-by-one in order of time_point and order of scheduling. But, unlike `rpp::schedulers::thread_pool`, worker is not pinned to some thread: strand with ready schedulables is placed to local lock-free queue of thread which made it ready (or to shared queue if it is not thread of this pool), and idle threads steal ready strands from queues of other threads. Strands waiting for delayed schedulables are stored in shared timer heap and become ready when any thread of pool finds that timer is expired.
+     *
+     * @par Examples
+     * @snippet thread_pool.cpp work_stealing_thread_pool
+     * @snippet thread_pool.cpp thread_pool_options
+     *
+     * @ingroup schedulers
+     */
+    class work_stealing_thread_pool final
+    {
+        class task
+        {
+        public:
+            virtual ~task() noexcept = default;
+
+            /**
+             * @brief Execute ready part of work. Called only by one thread at a time.
+             */
+            virtual void run() noexcept = 0;
+
+            /**
+             * @brief Called when timer registered for this task is expired
+             */
+            virtual void on_timer(time_point timepoint) noexcept = 0;
+        };
+
+        class state final
+        {
+            static constexpr size_t s_local_queue_capacity = 256;
+
+            struct timer
+            {
+                time_point            timepoint;
+                std::shared_ptr<task> target;
+
+                bool operator>(const timer& other) const { return timepoint > other.timepoint; }
+            };
+
+            struct thread_context
+            {
+                const state* owner;
+                size_t       index;
+            };
+
+        public:
+            state(size_t threads_count, duration timer_slack)
+                : m_threads_count{threads_count}
+                , m_timer_slack{timer_slack}
+                , m_local_queues{std::make_unique<details::work_stealing_queue<task, s_local_queue_capacity>[]>(threads_count)}
+            {
+            }
+
+            static void start(const std::shared_ptr<state>& self, const thread_pool_options& options)
+            {
+                for (size_t i = 0; i < self->m_threads_count; ++i)
+                    std::thread{&data_thread, self, i, options.get_thread_options(i)}.detach();
+            }
+
+            void stop()
+            {
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_is_stopping = true;
+                }
+                m_cv.notify_all();
+            }
+
+            void on_task_created() { m_tasks_count.fetch_add(1, std::memory_order_relaxed); }
+
+            void on_task_destroyed()
+            {
+                if (m_tasks_count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    return;
+
+                {
+                    std::lock_guard lock{m_mutex};
+                }
+                m_cv.notify_all();
+            }
+
+            /**
+             * @brief Places task to the queue of ready tasks
+             * @param notify wake up sleeping thread to steal this task
+             */
+            void submit(task* t, bool notify = true)
+            {
+                const auto& context = get_thread_context();
+                if (context.owner == this && m_local_queues[context.index].push(t))
+                {
+                    if (notify)
+                    {
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        if (m_sleeping_count.load(std::memory_order_relaxed) != 0)
+                        {
+                            std::lock_guard lock{m_mutex};
+                            m_cv.notify_one();
+                        }
+                    }
+                    return;
+                }
+
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_injected.push_back(t);
+                    m_has_injected.store(true, std::memory_order_relaxed);
+                }
+                m_cv.notify_one();
+            }
+
+            void add_timer(time_point timepoint, std::shared_ptr<task> target)
+            {
+                bool is_earliest{};
+                {
+                    std::lock_guard lock{m_mutex};
+                    is_earliest = m_timers.empty() || timepoint < m_timers.front().timepoint;
+                    m_timers.push_back(timer{timepoint, std::move(target)});
+                    std::push_heap(m_timers.begin(), m_timers.end(), std::greater<>{});
+                    update_next_timer();
+                }
+                // only one sleeping thread waits for timer, so need to notify all to be sure it re-calculates timeout
+                if (is_earliest)
+                    m_cv.notify_all();
+            }
+
+        private:
+            static thread_context& get_thread_context()
+            {
+                thread_local thread_context s_context{};
+                return s_context;
+            }
+
+            static void data_thread(std::shared_ptr<state> self, size_t index, thread_options options)
+            {
+                details::apply_to_current_thread(options);
+                get_thread_context() = thread_context{self.get(), index};
+                self->process(index);
+                get_thread_context() = thread_context{};
+            }
+
+            void process(size_t index)
+            {
+                while (true)
+                {
+                    fire_expired_timers();
+
+                    if (const auto t = find_task(index))
+                    {
+                        t->run();
+                        continue;
+                    }
+
+                    std::unique_lock lock{m_mutex};
+                    m_sleeping_count.fetch_add(1, std::memory_order_seq_cst);
+
+                    if (has_work_unsafe())
+                    {
+                        m_sleeping_count.fetch_sub(1, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    if (m_is_stopping && m_tasks_count.load(std::memory_order_acquire) == 0)
+                    {
+                        m_sleeping_count.fetch_sub(1, std::memory_order_relaxed);
+                        break;
+                    }
+
+                    if (!m_timers.empty() && !m_has_timer_waiter)
+                    {
+                        m_has_timer_waiter   = true;
+                        // timers expiring within slack after first one are fired by the same wake-up
+                        const auto timepoint = m_timers.front().timepoint + m_timer_slack;
+                        if (m_cv.wait_until(lock, timepoint) == std::cv_status::timeout)
+                            details::advance_now_to(timepoint);
+                        m_has_timer_waiter = false;
+                        // this thread could be busy for a long time, so someone else should wait for next timer
+                        if (m_sleeping_count.load(std::memory_order_relaxed) > 1)
+                            m_cv.notify_one();
+                    }
+                    else
+                    {
+                        m_cv.wait(lock);
+                    }
+                    m_sleeping_count.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
+            task* find_task(size_t index)
+            {
+                if (const auto t = m_local_queues[index].pop())
+                    return t;
+
+                if (m_has_injected.load(std::memory_order_relaxed))
+                {
+                    std::lock_guard lock{m_mutex};
+                    if (!m_injected.empty())
+                    {
+                        const auto t = m_injected.front();
+                        m_injected.pop_front();
+                        m_has_injected.store(!m_injected.empty(), std::memory_order_relaxed);
+                        return t;
+                    }
+                }
+
+                for (size_t i = 1; i < m_threads_count; ++i)
+                {
+                    if (const auto t = m_local_queues[(index + i) % m_threads_count].pop())
+                        return t;
+                }
+                return nullptr;
+            }
+
+            void fire_expired_timers()
+            {
+                if (details::now().time_since_epoch().count() < m_next_timer.load(std::memory_order_acquire))
+                    return;
+
+                while (true)
+                {
+                    std::shared_ptr<task> target{};
+                    time_point            timepoint{};
+                    {
+                        std::lock_guard lock{m_mutex};
+                        if (m_timers.empty() || m_timers.front().timepoint > details::s_last_now_time)
+                            return;
+
+                        std::pop_heap(m_timers.begin(), m_timers.end(), std::greater<>{});
+                        timepoint = m_timers.back().timepoint;
+                        target    = std::move(m_timers.back().target);
+                        m_timers.pop_back();
+                        update_next_timer();
+                    }
+                    target->on_timer(timepoint);
+                }
+            }
+
+            bool has_work_unsafe() const
+            {
+                if (!m_injected.empty())
+                    return true;
+
+                if (!m_timers.empty() && m_timers.front().timepoint <= details::now())
+                    return true;
+
+                for (size_t i = 0; i < m_threads_count; ++i)
+                {
+                    if (!m_local_queues[i].empty())
+                        return true;
+                }
+                return false;
+            }
+
+            void update_next_timer()
+            {
+                m_next_timer.store(m_timers.empty() ? std::numeric_limits<duration::rep>::max() : m_timers.front().timepoint.time_since_epoch().count(), std::memory_order_release);
+            }
+
+        private:
+            const size_t                                                                  m_threads_count;
+            const duration                                                                m_timer_slack;
+            std::unique_ptr<details::work_stealing_queue<task, s_local_queue_capacity>[]> m_local_queues;
+
+            std::mutex              m_mutex{};
+            std::condition_variable m_cv{};
+            std::deque<task*>       m_injected{};
+            std::vector<timer>      m_timers{};
+            bool                    m_is_stopping{};
+            bool                    m_has_timer_waiter{};
+
+            std::atomic_bool           m_has_injected{};
+            std::atomic<duration::rep> m_next_timer{std::numeric_limits<duration::rep>::max()};
+            std::atomic<size_t>        m_sleeping_count{};
+            std::atomic<size_t>        m_tasks_count{};
+        };
+
+        class strand final : public task
+            , public std::enable_shared_from_this<strand>
+        {
+            static constexpr size_t s_max_batch_size = 64;
+
+        public:
+            explicit strand(std::shared_ptr<state> pool_state)
+                : m_state{std::move(pool_state)}
+            {
+                m_state->on_task_created();
+            }
+
+            ~strand() noexcept override { m_state->on_task_destroyed(); }
+
+            strand(const strand&) = delete;
+            strand(strand&&)      = delete;
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args)
+            {
+                // destroyed after unlocking: destructors of schedulables can schedule to this strand again
+                typename decltype(m_queue)::compacted_schedulables compacted{};
+                std::unique_lock                                   lock{m_mutex};
+                compacted = m_queue.emplace(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                if (!m_self)
+                    activate_or_wait_for_timer(lock);
+            }
+
+            void run() noexcept override
+            {
+                {
+                    // all schedulables of batch observe the same "now" (if enabled)
+                    [[maybe_unused]] const details::batch_now_scope now_scope{};
+                    for (size_t i = 0; i < s_max_batch_size; ++i)
+                    {
+                        auto top = pop_ready();
+                        if (!top)
+                            break;
+
+                        execute(std::move(top));
+                    }
+                }
+
+                std::shared_ptr<strand> self{};
+                std::unique_lock        lock{m_mutex};
+                if (has_ready())
+                {
+                    lock.unlock();
+                    // current thread picks it up again as soon as possible, no need to wake up anyone else
+                    m_state->submit(this, false);
+                    return;
+                }
+
+                self = std::move(m_self);
+                activate_or_wait_for_timer(lock);
+            }
+
+            void on_timer(time_point timepoint) noexcept override
+            {
+                std::unique_lock lock{m_mutex};
+                if (m_timer == timepoint)
+                    m_timer.reset();
+
+                if (!m_self)
+                    activate_or_wait_for_timer(lock);
+            }
+
+        private:
+            void activate_or_wait_for_timer(std::unique_lock<std::recursive_mutex>& lock)
+            {
+                drop_disposed();
+                // disposing of schedulable could schedule something to this strand and activate it
+                if (m_self || m_queue.is_empty())
+                    return;
+
+                const auto timepoint = m_queue.top()->get_timepoint();
+                if (timepoint <= details::now())
+                {
+                    m_self = shared_from_this();
+                    lock.unlock();
+                    m_state->submit(this);
+                    return;
+                }
+
+                if (m_timer && m_timer.value() <= timepoint)
+                    return;
+
+                m_timer = timepoint;
+                auto self = shared_from_this();
+                lock.unlock();
+                m_state->add_timer(timepoint, std::move(self));
+            }
+
+            details::schedulable_ptr pop_ready()
+            {
+                std::lock_guard lock{m_mutex};
+                if (!has_ready())
+                    return {};
+                return m_queue.pop();
+            }
+
+            bool has_ready()
+            {
+                drop_disposed();
+                return !m_queue.is_empty() && m_queue.top()->get_timepoint() <= details::now();
+            }
+
+            void drop_disposed()
+            {
+                while (!m_queue.is_empty() && m_queue.top()->is_disposed())
+                    m_queue.pop();
+            }
+
+            void execute(details::schedulable_ptr&& top)
+            {
+                while (true)
+                {
+                    std::optional<details::schedulable_base::advanced_call> res{};
+                    {
+                        // schedulables scheduled via current_thread are executed right after current one
+                        const auto guard = current_thread::own_queue_and_drain_finally_if_not_owned();
+                        res              = top->make_advanced_call();
+                    }
+
+                    if (!res || top->is_disposed())
+                        return;
+
+                    typename decltype(m_queue)::compacted_schedulables compacted{};
+                    std::lock_guard                                    lock{m_mutex};
+                    if (res->can_run_immediately() && m_queue.is_empty())
+                    {
+                        details::batch_now_scope::refresh();
+                        continue;
+                    }
+
+                    const auto tp = top->handle_advanced_call(res.value());
+                    compacted     = m_queue.emplace(tp, std::move(top));
+                    return;
+                }
+            }
+
+        private:
+            std::shared_ptr<state> m_state;
+
+            std::recursive_mutex                                         m_mutex{};
+            details::schedulables_queue<current_thread::worker_strategy> m_queue{};
+            // keeps strand alive while it is placed to queue of ready tasks or executed. non-null only in this case
+            std::shared_ptr<strand>   m_self{};
+            std::optional<time_point> m_timer{};
+        };
+
+        class owner
+        {
+        public:
+            explicit owner(const thread_pool_options& options)
+                : m_state{std::make_shared<state>(std::max(size_t{1}, options.threads_count), options.timer_slack)}
+            {
+                state::start(m_state, options);
+            }
+
+            ~owner() noexcept { m_state->stop(); }
+
+            owner(const owner&) = delete;
+            owner(owner&&)      = delete;
+
+            const std::shared_ptr<state>& get_state() const { return m_state; }
+
+        private:
+            std::shared_ptr<state> m_state;
+        };
+
+        class worker_strategy
+        {
+        public:
+            explicit worker_strategy(std::shared_ptr<strand> strand)
+                : m_strand{std::move(strand)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_strand->defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static rpp::schedulers::time_point now() { return details::now(); }
+
+        private:
+            std::shared_ptr<strand> m_strand;
+        };
+
+    public:
+        explicit work_stealing_thread_pool(size_t threads_count = std::thread::hardware_concurrency())
+            : work_stealing_thread_pool{thread_pool_options{.threads_count = threads_count}}
+        {
+        }
+
+        /**
+         * @param options amount of threads, their names and CPU affinity
+         */
+        explicit work_stealing_thread_pool(const thread_pool_options& options)
+            : m_owner{std::make_shared<owner>(options)}
+        {
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{std::make_shared<strand>(m_owner->get_state())};
+        }
+
+    private:
+        std::shared_ptr<owner> m_owner{};
+    };
+} // namespace rpp::schedulers
@@ -125,7 +125,8 @@ namespace rpp::details
 
         RPP_NO_UNIQUE_ADDRESS PackedContainer container;
 
-        using value_type = rpp::utils::extract_observable_type_t<utils::iterable_value_t<PackedContainer>>;
+        using value_type                   = rpp::utils::extract_observable_type_t<utils::iterable_value_t<PackedContainer>>;
+        using expected_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
 
         template<constraint::observer_strategy<value_type> Strategy>
         void subscribe(observer<value_type, Strategy>&& obs) const
@@ -20,3 +20,4 @@
 #include <rpp/subjects/behavior_subject.hpp>
 #include <rpp/subjects/publish_subject.hpp>
 #include <rpp/subjects/replay_subject.hpp>
+#include <rpp/subjects/sharded_publish_subject.hpp>
@@ -0,0 +1,213 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/utils/constraints.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace rpp::subjects::details
+{
+    /**
+     * @brief Buffer of values for replay_subject.
+     * @details Values are stored in append-only chunks shared with snapshots, so replay of values to new observer doesn't copy them: snapshot just keeps references to chunks and iterates over them without any lock.
+     * Chunk dropped from the front of buffer is reused for new values as soon as there are no snapshots referencing it, so buffer with limited count of values works as ring buffer without any allocations in steady state.
+     * Timepoints are stored only if buffer needs them (duration limit is used).
+     */
+    template<rpp::constraint::decayed_type Type>
+    class replay_buffer
+    {
+        using time_point = rpp::schedulers::clock_type::time_point;
+
+        class chunk
+        {
+        public:
+            chunk(size_t capacity, bool with_timepoints)
+                : m_values{std::allocator<Type>{}.allocate(capacity)}
+                , m_timepoints{with_timepoints ? std::make_unique<time_point[]>(capacity) : nullptr}
+                , m_capacity{capacity}
+            {
+            }
+
+            chunk(const chunk&) = delete;
+            chunk(chunk&&)      = delete;
+
+            ~chunk() noexcept
+            {
+                destroy_values_before(m_size);
+                std::allocator<Type>{}.deallocate(m_values, m_capacity);
+            }
+
+            size_t size() const { return m_size; }
+            bool   is_full() const { return m_size == m_capacity; }
+
+            const Type& value(size_t index) const { return m_values[index]; }
+            time_point  timepoint(size_t index) const { return m_timepoints ? m_timepoints[index] : time_point{}; }
+
+            void emplace_back(const Type& v, time_point timepoint)
+            {
+                std::construct_at(m_values + m_size, v);
+                if (m_timepoints)
+                    m_timepoints[m_size] = timepoint;
+                ++m_size;
+            }
+
+            void destroy_values_before(size_t index) noexcept
+            {
+                for (; m_destroyed < index; ++m_destroyed)
+                    std::destroy_at(m_values + m_destroyed);
+            }
+
+            void reset() noexcept
+            {
+                destroy_values_before(m_size);
+                m_size      = 0;
+                m_destroyed = 0;
+            }
+
+        private:
+            Type*                         m_values;
+            std::unique_ptr<time_point[]> m_timepoints;
+            size_t                        m_capacity;
+            size_t                        m_size{};
+            size_t                        m_destroyed{};
+        };
+
+        using chunk_ptr = std::shared_ptr<chunk>;
+
+    public:
+        /**
+         * @brief Stable view of values of buffer at the moment of its creation. Values are not affected by any further changes of buffer.
+         */
+        class snapshot
+        {
+        public:
+            template<std::invocable<const Type&> Fn>
+            void for_each(Fn&& fn) const
+            {
+                for (const auto& r : m_ranges)
+                {
+                    for (size_t i = r.begin; i < r.end; ++i)
+                        fn(r.values->value(i));
+                }
+            }
+
+        private:
+            friend class replay_buffer;
+
+            struct range
+            {
+                std::shared_ptr<const chunk> values;
+                size_t                       begin;
+                size_t                       end;
+            };
+
+            std::vector<range> m_ranges{};
+        };
+
+        replay_buffer(size_t limit, bool with_timepoints)
+            : m_limit{limit}
+            , m_chunk_capacity{limit == std::numeric_limits<size_t>::max() ? 64 : std::clamp<size_t>(limit / 8, 1, 1024)}
+            , m_with_timepoints{with_timepoints}
+        {
+        }
+
+        void push_back(const Type& v, time_point timepoint)
+        {
+            if (m_size == m_limit)
+                pop_front();
+
+            if (m_chunks.empty() || m_chunks.back()->is_full())
+                m_chunks.push_back(acquire_chunk());
+
+            m_chunks.back()->emplace_back(v, timepoint);
+            ++m_size;
+        }
+
+        template<std::predicate<time_point> Pred>
+        void pop_front_while(Pred&& pred)
+        {
+            while (m_size != 0 && pred(m_chunks.front()->timepoint(m_front)))
+                pop_front();
+        }
+
+        snapshot get_snapshot() const
+        {
+            snapshot result{};
+            result.m_ranges.reserve(m_chunks.size());
+            for (size_t i = 0; i < m_chunks.size(); ++i)
+            {
+                const size_t begin = i == 0 ? m_front : 0;
+                const size_t end   = m_chunks[i]->size();
+                if (begin != end)
+                    result.m_ranges.push_back({m_chunks[i], begin, end});
+            }
+            return result;
+        }
+
+    private:
+        void pop_front()
+        {
+            auto& front = m_chunks.front();
+            ++m_front;
+            --m_size;
+
+            const bool is_exclusive = is_owned_exclusively(front);
+            if (is_exclusive)
+                front->destroy_values_before(m_front);
+
+            if (m_front != front->size() || !front->is_full())
+                return;
+
+            if (is_exclusive)
+            {
+                front->reset();
+                m_spare = std::move(front);
+            }
+            m_chunks.pop_front();
+            m_front = 0;
+        }
+
+        chunk_ptr acquire_chunk()
+        {
+            if (m_spare)
+                return std::exchange(m_spare, chunk_ptr{});
+            return std::make_shared<chunk>(m_chunk_capacity, m_with_timepoints);
+        }
+
+        static bool is_owned_exclusively(const chunk_ptr& ptr)
+        {
+            // snapshots are created only under lock of buffer's owner, so amount of references can't increase right now
+            if (ptr.use_count() != 1)
+                return false;
+
+            // synchronize with release of last snapshot to be sure that it doesn't read values anymore
+            std::atomic_thread_fence(std::memory_order::acquire);
+            return true;
+        }
+
+    private:
+        std::deque<chunk_ptr> m_chunks{};
+        chunk_ptr             m_spare{};
+        size_t                m_front{};
+        size_t                m_size{};
+
+        const size_t m_limit;
+        const size_t m_chunk_capacity;
+        const bool   m_with_timepoints;
+    };
+} // namespace rpp::subjects::details
@@ -14,16 +14,20 @@
 #include <rpp/disposables/callback_disposable.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/instrumentation.hpp>
 #include <rpp/observers/dynamic_observer.hpp>
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/functors.hpp>
 #include <rpp/utils/utils.hpp>
 
 #include <algorithm>
-#include <deque>
+#include <atomic>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <variant>
+#include <vector>
 
 namespace rpp::subjects::details
 {
@@ -44,32 +48,168 @@ namespace rpp::subjects::details
             , public rpp::details::base_disposable
         {
         public:
-            disposable_with_observer(TObs&& observer, std::weak_ptr<subject_state> state)
+            disposable_with_observer(TObs&& observer, disposable_wrapper_impl<subject_state> state)
                 : rpp::details::observers::type_erased_observer<TObs>{std::move(observer)}
                 , m_state{std::move(state)}
             {
+                rpp::details::instrumentation::on_allocated(rpp::details::instrumentation::category::subject_observers, sizeof(disposable_with_observer));
+            }
+
+            disposable_with_observer(const disposable_with_observer&) = delete;
+            disposable_with_observer(disposable_with_observer&&)      = delete;
+
+            ~disposable_with_observer() noexcept override
+            {
+                rpp::details::instrumentation::on_deallocated(rpp::details::instrumentation::category::subject_observers, sizeof(disposable_with_observer));
             }
 
         private:
+            friend class subject_state;
+
             void base_dispose_impl(interface_disposable::Mode) noexcept override
             {
                 if (const auto shared = m_state.lock())
                 {
-                    std::unique_lock lock{shared->m_mutex};
+                    retired_observers reclaimed{};
+                    std::unique_lock  lock{shared->m_mutex};
                     process_state_unsafe(shared->m_state,
-                                         [&](const shared_observers& observers) {
-                                             shared->m_state = cleanup_observers(observers, this);
+                                         [&](const observers_ptr& observers) {
+                                             reclaimed = shared->remove_observer_unsafe(*observers, m_index);
                                          });
                 }
             }
 
-            std::weak_ptr<subject_state> m_state{};
+            disposable_wrapper_impl<subject_state> m_state{};
+            // position inside of current snapshot of observers, guarded by subject's mutex
+            size_t m_index{};
+        };
+
+        using observer_base = rpp::details::observers::observer_vtable<Type>;
+        using observer      = rpp::disposable_ptr<observer_base>;
+
+        /**
+         * @brief Observer inside of snapshot: on_next function is kept right next to pointer to observer, so delivery of value doesn't need to load vtable of each observer.
+         * @details Unsubscribed observer is not removed from snapshot immediately, but marked with number of emission it was unsubscribed during: this emission still delivers value to it, while next ones skip it.
+         */
+        struct observer_slot
+        {
+            static constexpr size_t not_removed = std::numeric_limits<size_t>::max();
+
+            void on_next(const Type& v) const { on_next_ptr(obs, v); }
+
+            bool is_active_for(size_t emission) const { return removed_at.load(std::memory_order_relaxed) >= emission; }
+            bool is_removed() const { return removed_at.load(std::memory_order_relaxed) != not_removed; }
+
+            typename observer_base::on_next_lvalue_fn on_next_ptr{};
+            const observer_base*                      obs{};
+            std::atomic<size_t>                       removed_at{not_removed};
+        };
+
+        /**
+         * @brief Part of observer inside of snapshot not needed during delivery of values.
+         */
+        struct observer_owner
+        {
+            observer obs{};
+            // position of observer inside of snapshot is stored inside of observer itself to find it during unsubscribe, it is updated when observer moves to new snapshot
+            size_t* index{};
+        };
+
+        using observers_view = std::span<const observer_slot>;
+
+        /**
+         * @brief Contiguous array of observers published to on_next callers. Already published observers are never moved, so readers don't need any lock.
+         * @details New observer is appended in-place while there is free capacity: readers obtain size once, so they never see observers appended after that. Removed observers are dropped only when snapshot is rebuilt during growth or when more than half of snapshot is removed, so unsubscribe is O(1) amortized.
+         */
+        class observers_snapshot
+        {
+        public:
+            explicit observers_snapshot(size_t capacity)
+                : m_slots{std::make_unique<observer_slot[]>(capacity)}
+                , m_owners{std::make_unique<observer_owner[]>(capacity)}
+                , m_capacity{capacity}
+            {
+            }
+
+            observers_view get() const { return {m_slots.get(), m_size.load(std::memory_order_acquire)}; }
+
+            bool has_removed() const { return m_removed.load(std::memory_order_relaxed) != 0; }
+
+            bool try_emplace_back(const observer& obs, size_t& index)
+            {
+                const auto size = m_size.load(std::memory_order_relaxed);
+                if (size == m_capacity)
+                    return false;
+
+                m_slots[size].on_next_ptr = obs->get_on_next_lvalue();
+                m_slots[size].obs         = obs.get();
+                m_owners[size]            = observer_owner{obs, &index};
+                index                     = size;
+                m_size.store(size + 1, std::memory_order_release);
+                return true;
+            }
+
+            void remove(size_t index, size_t emission)
+            {
+                m_slots[index].removed_at.store(emission, std::memory_order_relaxed);
+                m_removed.store(m_removed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            size_t active_count() const { return m_size.load(std::memory_order_relaxed) - m_removed.load(std::memory_order_relaxed); }
+
+            bool needs_compaction() const { return m_removed.load(std::memory_order_relaxed) * 2 > m_size.load(std::memory_order_relaxed); }
+
+            void copy_active_to(observers_snapshot& other) const
+            {
+                const auto size = m_size.load(std::memory_order_relaxed);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (!m_slots[i].is_removed())
+                        other.try_emplace_back(m_owners[i].obs, *m_owners[i].index);
+                }
+            }
+
+        private:
+            std::unique_ptr<observer_slot[]>  m_slots;
+            std::unique_ptr<observer_owner[]> m_owners;
+            size_t                            m_capacity;
+            std::atomic<size_t>               m_size{};
+            std::atomic<size_t>               m_removed{};
         };
 
-        using observer         = std::shared_ptr<rpp::details::observers::observer_vtable<Type>>;
-        using observers        = std::deque<observer>;
-        using shared_observers = std::shared_ptr<observers>;
-        using state_t          = std::variant<shared_observers, std::exception_ptr, completed, disposed>;
+        using observers_ptr     = std::unique_ptr<observers_snapshot>;
+        using retired_observers = std::vector<observers_ptr>;
+        using state_t           = std::variant<observers_ptr, std::exception_ptr, completed, disposed>;
+
+        /**
+         * @brief Marks on_next call as reader of snapshot of observers, so it can't be reclaimed till end of this call.
+         * @details on_next calls are serialized (by observable contract or by serialized mutex), so readers can overlap only via recursive on_next from observer's callback. Such an readers are strictly nested, so reader can just restore previous amount of readers instead of decrementing it.
+         */
+        class reader_guard
+        {
+        public:
+            explicit reader_guard(subject_state& state)
+                : m_state{state}
+                , m_previous_readers{m_state.m_readers.fetch_add(1, std::memory_order_seq_cst)}
+            {
+            }
+
+            reader_guard(const reader_guard&) = delete;
+            reader_guard(reader_guard&&)      = delete;
+
+            ~reader_guard() noexcept
+            {
+                // snapshot retired while we are still reader would be reclaimed by this or next reader/writer
+                const bool has_retired = m_state.m_has_retired.load(std::memory_order_seq_cst);
+                m_state.m_readers.store(m_previous_readers, std::memory_order_release);
+                if (has_retired)
+                    m_state.reclaim_retired();
+            }
+
+        private:
+            subject_state& m_state;
+            size_t         m_previous_readers;
+        };
 
     public:
         using expected_disposable_strategy = rpp::details::observables::atomic_fixed_disposable_strategy_selector<1>;
@@ -79,25 +219,25 @@ namespace rpp::subjects::details
         template<rpp::constraint::observer_of_type<Type> TObs>
         void on_subscribe(TObs&& observer)
         {
-            std::unique_lock lock{m_mutex};
+            retired_observers reclaimed{};
+            std::unique_lock  lock{m_mutex};
             process_state_unsafe(
                 m_state,
-                [&](const shared_observers& observers) {
-                    auto d   = disposable_wrapper_impl<disposable_with_observer<std::decay_t<TObs>>>::make(std::forward<TObs>(observer), this->wrapper_from_this().lock());
-                    auto ptr = d.lock();
-                    if (!observers)
+                [&](const observers_ptr& observers) {
+                    auto       d    = disposable_wrapper_impl<disposable_with_observer<std::decay_t<TObs>>>::make(std::forward<TObs>(observer), this->weak_wrapper_from_this());
+                    const auto weak = d.as_weak();
+                    auto       ptr  = std::move(d).lock();
+                    if (!observers || !observers->try_emplace_back(ptr, ptr->m_index))
                     {
-                        auto new_observers = std::make_shared<subject_state::observers>();
-                        new_observers->emplace_back(ptr);
-                        m_state = std::move(new_observers);
-                    }
-                    else
-                    {
-                        observers->emplace_back(ptr);
+                        auto new_observers = rebuild_observers(observers.get(), 1);
+                        new_observers->try_emplace_back(ptr, ptr->m_index);
+
+                        publish_observers_unsafe(std::move(new_observers));
+                        reclaimed = extract_reclaimable_unsafe();
                     }
 
                     lock.unlock();
-                    ptr->set_upstream(d.as_weak());
+                    ptr->set_upstream(weak);
                 },
                 [&](const std::exception_ptr& err) {
                     lock.unlock();
@@ -111,31 +251,46 @@ namespace rpp::subjects::details
 
         void on_next(const Type& v)
         {
-            std::unique_lock observers_lock{m_mutex};
+            std::lock_guard lock{m_serialized_mutex};
 
-            if (!std::holds_alternative<shared_observers>(m_state))
-                return;
+            // no m_mutex there: snapshot of observers can't be reclaimed while there is any reader
+            const reader_guard guard{*this};
 
-            // we are getting copy of curent deque and obtaining CURRENT begin/end of in case of some new observer would be added during on_next call
-            const auto observers = std::get<shared_observers>(m_state);
+            const auto* observers = m_observers.load(std::memory_order_seq_cst);
             if (!observers)
                 return;
 
-            const auto begin = observers->cbegin();
-            const auto end   = observers->cend();
+            // emissions are serialized, so there is no need in atomic increment
+            const auto emission = m_emissions.load(std::memory_order_relaxed) + 1;
+            m_emissions.store(emission, std::memory_order_relaxed);
 
-            observers_lock.unlock();
+            // obtaining CURRENT size of snapshot in case of some new observer would be added during on_next call
+            const auto current = observers->get();
 
-            std::lock_guard lock{m_serialized_mutex};
-            std::for_each(begin, end, [&](const observer& obs) { obs->on_next(v); });
+            // observers removed during this emission still obtain value, so there is nothing to skip if nothing was removed before
+            if (!observers->has_removed())
+            {
+                std::for_each(current.begin(), current.end(), [&](const observer_slot& slot) { slot.on_next(v); });
+                return;
+            }
+
+            std::for_each(current.begin(), current.end(), [&](const observer_slot& slot) {
+                if (slot.is_active_for(emission))
+                    slot.on_next(v);
+            });
         }
 
         void on_error(const std::exception_ptr& err)
         {
             {
                 std::lock_guard lock{m_serialized_mutex};
-                if (const auto observers = exchange_observers_under_lock_if_there(err))
-                    rpp::utils::for_each(*observers, [&](const observer& obs) { obs->on_error(err); });
+                auto            observers = exchange_observers_under_lock_if_there(err);
+                if (observers)
+                    rpp::utils::for_each(observers->get(), [&](const observer_slot& slot) {
+                        if (!slot.is_removed())
+                            slot.obs->on_error(err);
+                    });
+                retire(std::move(observers));
             }
             dispose();
         }
@@ -144,8 +299,13 @@ namespace rpp::subjects::details
         {
             {
                 std::lock_guard lock{m_serialized_mutex};
-                if (const auto observers = exchange_observers_under_lock_if_there(completed{}))
-                    rpp::utils::for_each(*observers, [](const observer& obs) { obs->on_completed(); });
+                auto            observers = exchange_observers_under_lock_if_there(completed{});
+                if (observers)
+                    rpp::utils::for_each(observers->get(), [](const observer_slot& slot) {
+                        if (!slot.is_removed())
+                            slot.obs->on_completed();
+                    });
+                retire(std::move(observers));
             }
             dispose();
         }
@@ -153,22 +313,32 @@ namespace rpp::subjects::details
     private:
         void composite_dispose_impl(interface_disposable::Mode) noexcept override
         {
-            exchange_observers_under_lock_if_there(disposed{});
+            retire(exchange_observers_under_lock_if_there(disposed{}));
         }
 
-        static shared_observers cleanup_observers(const shared_observers& current_subs, const rpp::details::observers::observer_vtable<Type>* to_delete)
+        /**
+         * @brief Copies active observers of current snapshot (if any) into new one with enough capacity for extra observers. Returns empty pointer if there is nothing to store.
+         */
+        static observers_ptr rebuild_observers(const observers_snapshot* current, size_t extra)
         {
-            auto subs = std::make_shared<observers>();
-            if (current_subs)
-            {
-                std::copy_if(current_subs->cbegin(),
-                             current_subs->cend(),
-                             std::back_inserter(*subs),
-                             [&to_delete](const observer& obs) {
-                                 return to_delete != obs.get() && !obs->is_disposed();
-                             });
-            }
-            return subs;
+            const size_t count = (current ? current->active_count() : 0) + extra;
+            if (count == 0)
+                return {};
+
+            auto result = std::make_unique<observers_snapshot>(std::max(size_t{4}, count * 2));
+            if (current)
+                current->copy_active_to(*result);
+            return result;
+        }
+
+        retired_observers remove_observer_unsafe(observers_snapshot& observers, size_t index)
+        {
+            observers.remove(index, m_emissions.load(std::memory_order_relaxed));
+            if (!observers.needs_compaction())
+                return {};
+
+            publish_observers_unsafe(rebuild_observers(&observers, 0));
+            return extract_reclaimable_unsafe();
         }
 
         static void process_state_unsafe(const state_t& state, const auto&... actions)
@@ -176,18 +346,66 @@ namespace rpp::subjects::details
             std::visit(rpp::utils::overloaded{actions..., rpp::utils::empty_function_any_t{}}, state);
         }
 
-        shared_observers exchange_observers_under_lock_if_there(state_t&& new_val)
+        void publish_observers_unsafe(observers_ptr&& new_observers)
+        {
+            m_observers.store(new_observers.get(), std::memory_order_seq_cst);
+            retire_unsafe(std::exchange(std::get<observers_ptr>(m_state), std::move(new_observers)));
+        }
+
+        observers_ptr exchange_observers_under_lock_if_there(state_t&& new_val)
         {
             std::lock_guard lock{m_mutex};
 
-            if (!std::holds_alternative<shared_observers>(m_state))
+            if (!std::holds_alternative<observers_ptr>(m_state))
+                return {};
+
+            m_observers.store(nullptr, std::memory_order_seq_cst);
+            return std::get<observers_ptr>(std::exchange(m_state, std::move(new_val)));
+        }
+
+        /**
+         * @brief Snapshot unpublished from m_observers can still be used by on_next started before that, so it is kept till moment when there are no readers at all.
+         */
+        void retire_unsafe(observers_ptr&& observers)
+        {
+            if (!observers)
+                return;
+
+            m_retired.push_back(std::move(observers));
+            m_has_retired.store(true, std::memory_order_seq_cst);
+        }
+
+        retired_observers extract_reclaimable_unsafe()
+        {
+            if (m_retired.empty() || m_readers.load(std::memory_order_seq_cst) != 0)
                 return {};
 
-            return std::get<shared_observers>(std::exchange(m_state, std::move(new_val)));
+            m_has_retired.store(false, std::memory_order_seq_cst);
+            return std::exchange(m_retired, {});
+        }
+
+        void retire(observers_ptr&& observers)
+        {
+            retired_observers reclaimed{};
+            std::lock_guard   lock{m_mutex};
+            retire_unsafe(std::move(observers));
+            reclaimed = extract_reclaimable_unsafe();
+        }
+
+        void reclaim_retired()
+        {
+            retired_observers reclaimed{};
+            std::lock_guard   lock{m_mutex};
+            reclaimed = extract_reclaimable_unsafe();
         }
 
     private:
         state_t                                                                                  m_state;
+        std::atomic<observers_snapshot*>                                                         m_observers{};
+        std::atomic<size_t>                                                                      m_readers{};
+        std::atomic<size_t>                                                                      m_emissions{};
+        std::atomic_bool                                                                         m_has_retired{};
+        retired_observers                                                                        m_retired{};
         std::mutex                                                                               m_mutex{};
         RPP_NO_UNIQUE_ADDRESS std::conditional_t<Serialized, std::mutex, rpp::utils::none_mutex> m_serialized_mutex{};
     };
@@ -12,6 +12,7 @@
 #include <rpp/disposables/fwd.hpp>
 #include <rpp/observables/fwd.hpp>
 #include <rpp/observers/fwd.hpp>
+#include <rpp/schedulers/fwd.hpp>
 
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/utils.hpp>
@@ -24,6 +25,12 @@ namespace rpp::subjects
     template<rpp::constraint::decayed_type Type>
     class serialized_publish_subject;
 
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class sharded_publish_subject;
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class serialized_sharded_publish_subject;
+
 
     template<rpp::constraint::decayed_type Type>
     class replay_subject;
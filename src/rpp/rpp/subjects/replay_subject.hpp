@@ -14,10 +14,12 @@
 
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/observers/observer.hpp>
+#include <rpp/subjects/details/replay_buffer.hpp>
 #include <rpp/subjects/details/subject_on_subscribe.hpp>
 #include <rpp/subjects/details/subject_state.hpp>
 
-#include <deque>
+#include <limits>
+#include <mutex>
 #include <utility>
 
 namespace rpp::subjects::details
@@ -28,7 +30,7 @@ namespace rpp::subjects::details
         struct replay_state final : public subject_state<Type, Serialized>
         {
             replay_state(size_t limit = std::numeric_limits<size_t>::max(), rpp::schedulers::duration duration_limit = std::numeric_limits<rpp::schedulers::duration>::max())
-                : m_limit(limit)
+                : m_values{limit, has_duration_limit(duration_limit)}
                 , m_duration_limit(duration_limit)
             {
             }
@@ -36,49 +38,36 @@ namespace rpp::subjects::details
             void add_value(const Type& v)
             {
                 std::unique_lock lock{m_values_mutex};
-                while (m_values.size() >= m_limit)
-                    m_values.pop_front();
-
-                m_values.emplace_back(v, deduce_timepoint());
+                m_values.push_back(v, deduce_timepoint());
             }
 
-            struct value_with_time
-            {
-                value_with_time(const Type& v, rpp::schedulers::clock_type::time_point timepoint)
-                    : value{v}
-                    , timepoint{timepoint}
-                {
-                }
-
-                Type                                    value;
-                rpp::schedulers::clock_type::time_point timepoint;
-            };
-
-
-            std::deque<value_with_time> get_actual_values()
+            typename replay_buffer<Type>::snapshot get_actual_values()
             {
                 std::unique_lock lock{m_values_mutex};
                 deduce_timepoint();
-                return m_values;
+                return m_values.get_snapshot();
             }
 
         private:
+            static bool has_duration_limit(rpp::schedulers::duration duration_limit)
+            {
+                return std::numeric_limits<rpp::schedulers::duration>::max() != duration_limit;
+            }
+
             rpp::schedulers::clock_type::time_point deduce_timepoint()
             {
-                if (std::numeric_limits<rpp::schedulers::duration>::max() == m_duration_limit)
+                if (!has_duration_limit(m_duration_limit))
                     return rpp::schedulers::clock_type::time_point{};
 
                 auto now = rpp::schedulers::clock_type::now();
-                while (!m_values.empty() && (now - m_values.front().timepoint > m_duration_limit))
-                    m_values.pop_front();
+                m_values.pop_front_while([&](rpp::schedulers::clock_type::time_point timepoint) { return now - timepoint > m_duration_limit; });
                 return now;
             }
 
         private:
-            std::mutex                  m_values_mutex{};
-            std::deque<value_with_time> m_values{};
+            std::mutex          m_values_mutex{};
+            replay_buffer<Type> m_values;
 
-            const size_t                    m_limit;
             const rpp::schedulers::duration m_duration_limit;
         };
 
@@ -86,7 +75,7 @@ namespace rpp::subjects::details
         {
             using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
 
-            std::shared_ptr<replay_state> state;
+            rpp::disposable_ptr<replay_state> state;
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
@@ -107,42 +96,40 @@ namespace rpp::subjects::details
         using expected_disposable_strategy = rpp::details::observables::deduce_disposable_strategy_t<details::subject_state<Type, Serialized>>;
 
         replay_subject_base()
-            : m_state{disposable_wrapper_impl<replay_state>::make()}
+            : m_state{disposable_wrapper_impl<replay_state>::make().lock()}
         {
         }
 
         replay_subject_base(size_t count)
-            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count))}
+            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count)).lock()}
         {
         }
 
         replay_subject_base(size_t count, rpp::schedulers::duration duration)
-            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count), duration)}
+            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count), duration).lock()}
         {
         }
 
         auto get_observer() const
         {
-            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+            return rpp::observer<Type, observer_strategy>{m_state};
         }
 
         auto get_observable() const
         {
             return create_subject_on_subscribe_observable<Type, expected_disposable_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
-                const auto locked = state.lock();
-                for (auto&& value : locked->get_actual_values())
-                    observer.on_next(std::move(value.value));
-                locked->on_subscribe(std::forward<TObs>(observer));
+                state->get_actual_values().for_each([&observer](const Type& value) { observer.on_next(value); });
+                state->on_subscribe(std::forward<TObs>(observer));
             });
         }
 
         rpp::disposable_wrapper get_disposable() const
         {
-            return m_state;
+            return m_state->wrapper_from_this();
         }
 
     private:
-        disposable_wrapper_impl<replay_state> m_state;
+        rpp::disposable_ptr<replay_state> m_state;
     };
 } // namespace rpp::subjects::details
 
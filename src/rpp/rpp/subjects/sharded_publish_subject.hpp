@@ -0,0 +1,163 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/subjects/fwd.hpp>
+
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/delay.hpp>
+#include <rpp/subjects/details/subject_on_subscribe.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rpp::subjects::details
+{
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler, bool Serialized>
+    class sharded_publish_subject_base
+    {
+        using shard = rpp::subjects::publish_subject<Type>;
+        // queue of emissions for shard drained on its own worker: same as `delay` operator with zero delay, so on_error/on_completed are delivered only after already emitted values
+        using shard_dispatcher = decltype(std::declval<const rpp::operators::details::delay_t<Scheduler, false>&>().template lift<Type>(std::declval<const shard&>().get_observer()));
+
+        struct sharded_state
+        {
+            sharded_state(const Scheduler& scheduler, size_t shards_count)
+            {
+                const rpp::operators::details::delay_t<Scheduler, false> dispatch{rpp::schedulers::duration{}, scheduler};
+
+                shards.reserve(shards_count);
+                dispatchers.reserve(shards_count);
+                for (size_t i = 0; i < shards_count; ++i)
+                {
+                    const auto& s = shards.emplace_back();
+                    dispatchers.push_back(dispatch.template lift<Type>(s.get_observer()));
+                    disposable.add(s.get_disposable());
+                }
+            }
+
+            template<typename Fn>
+            void for_each_dispatcher(const Fn& fn)
+            {
+                std::lock_guard lock{serialized_mutex};
+                std::for_each(dispatchers.cbegin(), dispatchers.cend(), fn);
+            }
+
+            std::vector<shard>                                                                       shards{};
+            std::vector<shard_dispatcher>                                                            dispatchers{};
+            std::atomic<size_t>                                                                      next_shard{};
+            rpp::composite_disposable_wrapper                                                        disposable = rpp::composite_disposable_wrapper::make();
+            RPP_NO_UNIQUE_ADDRESS std::conditional_t<Serialized, std::mutex, rpp::utils::none_mutex> serialized_mutex{};
+        };
+
+        struct observer_strategy
+        {
+            using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+            std::shared_ptr<sharded_state> state{};
+
+            void set_upstream(const disposable_wrapper& d) const noexcept { state->disposable.add(d); }
+
+            bool is_disposed() const noexcept { return state->disposable.is_disposed(); }
+
+            void on_next(const Type& v) const
+            {
+                state->for_each_dispatcher([&v](const shard_dispatcher& dispatcher) { dispatcher.on_next(v); });
+            }
+
+            void on_error(const std::exception_ptr& err) const
+            {
+                state->for_each_dispatcher([&err](const shard_dispatcher& dispatcher) { dispatcher.on_error(err); });
+            }
+
+            void on_completed() const
+            {
+                state->for_each_dispatcher([](const shard_dispatcher& dispatcher) { dispatcher.on_completed(); });
+            }
+        };
+
+    public:
+        using expected_disposable_strategy = typename shard::expected_disposable_strategy;
+
+        explicit sharded_publish_subject_base(const Scheduler& scheduler, size_t shards_count = std::thread::hardware_concurrency())
+            : m_state{std::make_shared<sharded_state>(scheduler, std::max(size_t{1}, shards_count))}
+        {
+        }
+
+        auto get_observer() const
+        {
+            return rpp::observer<Type, observer_strategy>{m_state};
+        }
+
+        auto get_observable() const
+        {
+            return create_subject_on_subscribe_observable<Type, expected_disposable_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
+                const auto index = state->next_shard.fetch_add(1, std::memory_order_relaxed) % state->shards.size();
+                state->shards[index].get_observable().subscribe(std::forward<TObs>(observer));
+            });
+        }
+
+        rpp::composite_disposable_wrapper get_disposable() const
+        {
+            return m_state->disposable;
+        }
+
+    private:
+        std::shared_ptr<sharded_state> m_state;
+    };
+} // namespace rpp::subjects::details
+
+namespace rpp::subjects
+{
+    /**
+     * @brief Same as rpp::subjects::publish_subject, but observers are partitioned into shards and each shard delivers values to its observers on its own worker of provided scheduler.
+     *
+     * @details Use it when there are a lot of observers with noticeable on_next callbacks: emitting thread just enqueues value for each shard instead of invoking all observers sequentially. Values emitted while shard is busy are batched and delivered by the same scheduled drain.
+     * @details Each observer belongs to exactly one shard (assigned in round-robin manner during subscription), so it obtains all emissions (values, error, completion) serially and in original order, but different observers can obtain the same value in parallel.
+     *
+     * @warning on_next/on_error/on_completed return before observers obtain emission. Observer subscribed right after emission can still obtain this value if its shard hasn't delivered it yet.
+     * @warning this subject is not synchronized/serialized! It means, that expected to call callbacks of observer in the serialized way to follow observable contract. If you are not sure or need extra serialization, please, use serialized_sharded_publish_subject.
+     *
+     * @param scheduler provides workers for shards, e.g. rpp::schedulers::thread_pool to deliver values from different threads.
+     * @param shards_count amount of shards (and workers obtained from scheduler)
+     *
+     * @tparam Type value provided by this subject
+     * @tparam Scheduler type of scheduler used to deliver values
+     *
+     * @ingroup subjects
+     * @see https://reactivex.io/documentation/subject.html
+     */
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class sharded_publish_subject final : public details::sharded_publish_subject_base<Type, Scheduler, false>
+    {
+    public:
+        using details::sharded_publish_subject_base<Type, Scheduler, false>::sharded_publish_subject_base;
+    };
+
+    /**
+     * @brief Serialized version of rpp::subjects::sharded_publish_subject
+     * @details When you are using ordinary rpp::subjects::sharded_publish_subject, then you must take care not to call its on_next method (or its other on methods) in async way.
+     *
+     * @ingroup subjects
+     * @see https://reactivex.io/documentation/subject.html
+     */
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class serialized_sharded_publish_subject final : public details::sharded_publish_subject_base<Type, Scheduler, true>
+    {
+    public:
+        using details::sharded_publish_subject_base<Type, Scheduler, true>::sharded_publish_subject_base;
+    };
+} // namespace rpp::subjects
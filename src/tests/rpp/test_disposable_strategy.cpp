@@ -0,0 +1,172 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#include <doctest/doctest.h>
+
+#include <rpp/rpp.hpp>
+
+#include <rpp/schedulers/test_scheduler.hpp>
+
+#include "disposable_observable.hpp"
+
+#include <chrono>
+
+namespace
+{
+    using rpp::details::observables::AtomicMode;
+    using rpp::details::observables::default_disposable_strategy_selector;
+
+    template<size_t Count, AtomicMode Mode = AtomicMode::NonAtomic>
+    using fixed = rpp::details::observables::fixed_disposable_strategy_selector<Count, Mode>;
+
+    template<size_t Count, AtomicMode Mode = AtomicMode::NonAtomic>
+    using dynamic = rpp::details::observables::dynamic_disposable_strategy_selector<Count, Mode>;
+
+    template<typename Observable>
+    using strategy_of = rpp::details::observables::deduce_disposable_strategy_t<std::decay_t<Observable>>;
+
+    template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy Strategy>
+    struct wrapped_observable_strategy_set_upstream_and_error
+    {
+        using value_type                   = Type;
+        using expected_disposable_strategy = Strategy;
+
+        auto subscribe(auto&& observer) const
+        {
+            observer.set_upstream(rpp::composite_disposable_wrapper::make());
+            observer.on_error({});
+        }
+    };
+
+    template<typename Strategy>
+    auto source_with()
+    {
+        return rpp::observable<int, wrapped_observable_strategy_set_upstream<int, Strategy>>{};
+    }
+
+    const auto just         = rpp::source::just(1);
+    const auto fixed_1      = source_with<fixed<1>>();
+    const auto dynamic_2    = source_with<dynamic<2>>();
+    const auto unknown      = source_with<default_disposable_strategy_selector>();
+    const auto immediate    = rpp::schedulers::immediate{};
+    const auto period       = std::chrono::seconds{1};
+    const auto identity     = [](int v) { return v; };
+    const auto to_just      = [](int v) { return rpp::source::just(v); };
+    const auto to_fixed_1   = [](const std::exception_ptr&) { return source_with<fixed<1>>(); };
+    const auto sum_of_three = [](int a, int b, int c) { return a + b + c; };
+} // namespace
+
+// clang-format off
+// sum of strategies
+static_assert(std::same_as<rpp::details::observables::sum_of_disposable_strategies<fixed<1>, fixed<2>>, fixed<3>>);
+static_assert(std::same_as<rpp::details::observables::sum_of_disposable_strategies<fixed<1>, fixed<0, AtomicMode::Atomic>>, fixed<1, AtomicMode::Atomic>>);
+static_assert(std::same_as<rpp::details::observables::sum_of_disposable_strategies<fixed<1>, dynamic<2>, fixed<3>>, dynamic<6>>);
+static_assert(std::same_as<rpp::details::observables::sum_of_disposable_strategies<fixed<1>, default_disposable_strategy_selector>, default_disposable_strategy_selector>);
+
+// sources
+static_assert(std::same_as<strategy_of<decltype(just)>, fixed<0>>);
+static_assert(std::same_as<strategy_of<decltype(rpp::source::never<int>())>, fixed<0>>);
+static_assert(std::same_as<strategy_of<decltype(rpp::source::timer(period, immediate))>, fixed<0>>);
+static_assert(std::same_as<strategy_of<decltype(rpp::source::concat(just, just))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(rpp::source::create<int>([](const auto&) {}))>, default_disposable_strategy_selector>);
+static_assert(std::same_as<strategy_of<decltype(rpp::subjects::publish_subject<int>{}.get_observable())>, fixed<1, AtomicMode::Atomic>>);
+static_assert(std::same_as<strategy_of<decltype(just.as_dynamic())>, default_disposable_strategy_selector>);
+
+// operators forwarding disposables of original observable as is
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::map(identity))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::filter([](int) { return true; }))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::scan(std::plus<int>{}))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::reduce(std::plus<int>{}))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::take(1))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::take_while([](int) { return true; }))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::take_last(1))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::skip(1))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::first())>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::last())>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::element_at(1))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::distinct())>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::distinct_until_changed())>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::tap())>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::buffer(2))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::throttle(period))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::delay(period, immediate))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::observe_on(immediate))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::subscribe_on(immediate))>, fixed<1>>);
+
+// operators adding own disposable to disposables of original observable
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::finally([]() noexcept {}))>, fixed<2>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::debounce(period, immediate))>, fixed<2>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::finally([]() noexcept {}))>, dynamic<3>>);
+
+// operators keeping all disposables inside of own disposable
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::merge_with(unknown))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::flat_map(to_just))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(rpp::source::just(unknown) | rpp::ops::concat())>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(rpp::source::just(unknown) | rpp::ops::switch_on_next())>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::start_with(1))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::repeat(2))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::retry(2))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::retry_when(to_fixed_1))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::window(2))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::window_toggle(just, [](int) { return rpp::source::just(1); }))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::group_by(identity))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<rpp::grouped_observable_group_by<int, int>>, fixed<1, AtomicMode::Atomic>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::with_latest_from(unknown))>, fixed<1>>);
+static_assert(std::same_as<strategy_of<decltype(dynamic_2 | rpp::ops::timeout(period, immediate))>, fixed<1>>);
+
+// operators forwarding disposables of multiple observables to the same observer
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::zip(fixed_1))>, fixed<3>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::combine_latest(sum_of_three, fixed_1, just))>, fixed<3>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::zip(dynamic_2))>, dynamic<4>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::zip(unknown))>, default_disposable_strategy_selector>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::take_until(fixed_1))>, fixed<2>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::take_until(unknown))>, default_disposable_strategy_selector>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::on_error_resume_next(to_fixed_1))>, fixed<2>>);
+static_assert(std::same_as<strategy_of<decltype(fixed_1 | rpp::ops::timeout(period, fixed_1, immediate))>, fixed<2>>);
+// clang-format on
+
+TEST_CASE("observer obtains exactly expected amount of disposables from operators combining observables")
+{
+    size_t     errors{};
+    const auto check = [&errors](const auto& observable) {
+        using strategy = strategy_of<decltype(observable)>;
+        static_assert(!std::same_as<strategy, default_disposable_strategy_selector>);
+
+        observable.subscribe([](const auto&) {}, [&errors](const std::exception_ptr&) { ++errors; });
+    };
+
+    SUBCASE("zip")
+    {
+        check(fixed_1 | rpp::ops::zip(fixed_1, dynamic_2));
+    }
+
+    SUBCASE("combine_latest")
+    {
+        check(fixed_1 | rpp::ops::combine_latest(sum_of_three, fixed_1, fixed_1));
+    }
+
+    SUBCASE("take_until")
+    {
+        check(fixed_1 | rpp::ops::take_until(fixed_1));
+    }
+
+    SUBCASE("on_error_resume_next")
+    {
+        check(rpp::observable<int, wrapped_observable_strategy_set_upstream_and_error<int, fixed<1>>>{} | rpp::ops::on_error_resume_next(to_fixed_1));
+    }
+
+    SUBCASE("timeout")
+    {
+        auto scheduler = rpp::schedulers::test_scheduler{};
+        check(fixed_1 | rpp::ops::timeout(std::chrono::seconds{1}, fixed_1, scheduler));
+        scheduler.time_advance(std::chrono::seconds{1});
+    }
+
+    CHECK(errors == 0u);
+}
@@ -13,6 +13,12 @@
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/refcount_disposable.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
 namespace
 {
     struct custom_disposable : public rpp::interface_disposable
@@ -27,7 +33,7 @@ namespace
     };
 } // namespace
 
-TEST_CASE_TEMPLATE("disposable keeps state", TestType, rpp::details::disposables::dynamic_disposables_container<0>, rpp::details::disposables::static_disposables_container<1>)
+TEST_CASE_TEMPLATE("disposable keeps state", TestType, rpp::details::disposables::dynamic_disposables_container<0>, rpp::details::disposables::dynamic_disposables_container<1>, rpp::details::disposables::static_disposables_container<1>, rpp::details::disposables::slots_disposables_container)
 {
     auto d = rpp::composite_disposable_wrapper::make<rpp::composite_disposable_impl<TestType>>();
 
@@ -267,6 +273,120 @@ TEST_CASE("refcount disposable dispose underlying in case of reaching zero")
     }
 }
 
+TEST_CASE("refcount disposable references are independent from each other")
+{
+    auto refcount = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+
+    SUBCASE("disposing of source disposes alive references and their dependencies")
+    {
+        std::vector<rpp::composite_disposable_wrapper> refs{};
+        std::vector<rpp::composite_disposable_wrapper> inners{};
+        for (size_t i = 0; i < 10; ++i)
+        {
+            refs.push_back(refcount.lock()->add_ref());
+            inners.push_back(rpp::composite_disposable_wrapper::make());
+            refs.back().add(inners.back());
+        }
+
+        refcount.dispose();
+        for (size_t i = 0; i < refs.size(); ++i)
+        {
+            CHECK(refs[i].is_disposed());
+            CHECK(inners[i].is_disposed());
+        }
+        CHECK(refcount.lock()->add_ref().is_disposed());
+    }
+
+    SUBCASE("released reference stays disposed when next reference re-uses its memory")
+    {
+        const auto keep_alive = refcount.lock()->add_ref();
+        for (size_t i = 0; i < 10; ++i)
+        {
+            auto old_ref = refcount.lock()->add_ref();
+            old_ref.dispose();
+
+            const auto new_ref = refcount.lock()->add_ref();
+            CHECK(old_ref.is_disposed());
+            CHECK(!new_ref.is_disposed());
+            new_ref.dispose();
+        }
+        CHECK(!refcount.is_disposed());
+    }
+
+    SUBCASE("destruction of last copy of reference releases it")
+    {
+        refcount.lock()->add_ref();
+        CHECK(refcount.is_disposed());
+    }
+
+    SUBCASE("weak reference outlives source")
+    {
+        auto       ref  = refcount.lock()->add_ref();
+        const auto weak = ref.as_weak();
+        refcount        = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::empty();
+        CHECK(!weak.is_disposed());
+
+        ref = rpp::composite_disposable_wrapper::empty();
+        CHECK(weak.is_disposed());
+    }
+}
+
+TEST_CASE("disposable_wrapper keeps reference counters inside of disposable")
+{
+    auto d = rpp::composite_disposable_wrapper::make();
+    CHECK(d.lock().use_count() == 2);
+
+    SUBCASE("weak wrapper doesn't own disposable")
+    {
+        const auto weak = d.as_weak();
+        CHECK(d.lock().use_count() == 2);
+        CHECK(weak == d);
+
+        d = rpp::composite_disposable_wrapper::empty();
+        CHECK(weak.is_disposed());
+        CHECK(weak.lock() == nullptr);
+    }
+
+    SUBCASE("disposable is disposed on destruction of last strong reference")
+    {
+        auto inner = rpp::composite_disposable_wrapper::make();
+        d.add(inner);
+        d = rpp::composite_disposable_wrapper::empty();
+        CHECK(inner.is_disposed());
+    }
+
+    SUBCASE("wrapper_from_this refers to the same disposable")
+    {
+        const auto refcount = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+        const auto ptr      = refcount.lock();
+
+        CHECK(ptr->wrapper_from_this() == refcount);
+        CHECK(ptr.use_count() == 2);
+
+        const auto weak = ptr->weak_wrapper_from_this();
+        CHECK(weak == refcount);
+        CHECK(ptr.use_count() == 2);
+    }
+
+    SUBCASE("locked disposable can be kept as std::shared_ptr")
+    {
+        auto inner = rpp::composite_disposable_wrapper::make();
+        d.add(inner);
+
+        const std::shared_ptr<rpp::interface_composite_disposable> shared = d.lock();
+        const std::shared_ptr<rpp::interface_disposable>           base   = d.lock();
+        CHECK(shared.get() == d.lock().get());
+        CHECK(d.lock().use_count() == 4);
+
+        d = rpp::composite_disposable_wrapper::empty();
+        CHECK(!inner.is_disposed());
+
+        shared->dispose();
+        CHECK(inner.is_disposed());
+        CHECK(std::shared_ptr<rpp::interface_disposable>{rpp::composite_disposable_wrapper::empty().lock()} == nullptr);
+    }
+}
+
 TEST_CASE("composite_disposable correctly handles exception")
 {
     auto d  = rpp::composite_disposable_wrapper::make<rpp::composite_disposable_impl<rpp::details::disposables::static_disposables_container<1>>>();
@@ -282,6 +402,139 @@ TEST_CASE("composite_disposable correctly handles exception")
     CHECK(!d2.is_disposed());
 }
 
+TEST_CASE("disposables keep consistent state under concurrent usage")
+{
+    constexpr size_t threads_count = 4;
+    constexpr size_t iterations    = 1000;
+
+    const auto run_in_parallel = [&](const auto& fn) {
+        std::vector<std::thread> threads{};
+        for (size_t i = 0; i < threads_count; ++i)
+            threads.emplace_back([&fn, i] { fn(i); });
+        for (auto& t : threads)
+            t.join();
+    };
+
+    SUBCASE("concurrent dispose runs callback exactly once")
+    {
+        for (size_t i = 0; i < iterations / 10; ++i)
+        {
+            std::atomic<size_t> count{};
+            const auto          d = rpp::make_callback_disposable([&count]() noexcept { count.fetch_add(1, std::memory_order::relaxed); });
+
+            run_in_parallel([&](size_t) { d.dispose(); });
+
+            CHECK(d.is_disposed());
+            CHECK(count.load() == 1);
+        }
+    }
+
+    SUBCASE("every disposable added concurrently with dispose is disposed and sees data written before adding")
+    {
+        auto                d = rpp::composite_disposable_wrapper::make();
+        std::atomic<size_t> disposed_count{};
+        std::atomic<size_t> mismatches_count{};
+
+        run_in_parallel([&](size_t index) {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                // plain non-atomic data published only via disposable's state
+                auto data = std::make_shared<size_t>();
+                *data     = index * iterations + i;
+                d.add(rpp::make_callback_disposable([&, data, expected = index * iterations + i]() noexcept {
+                    if (*data != expected)
+                        mismatches_count.fetch_add(1, std::memory_order::relaxed);
+                    disposed_count.fetch_add(1, std::memory_order::relaxed);
+                }));
+
+                if (index == 0 && i == iterations / 2)
+                    d.dispose();
+            }
+        });
+
+        CHECK(d.is_disposed());
+        CHECK(disposed_count.load() == threads_count * iterations);
+        CHECK(mismatches_count.load() == 0);
+    }
+
+    SUBCASE("add waiting for concurrent edit is woken up after its end")
+    {
+        auto             d = rpp::composite_disposable_wrapper::make();
+        std::atomic_bool clearing{};
+        std::atomic_bool released{};
+        d.add(rpp::make_callback_disposable([&]() noexcept {
+            clearing = true;
+            while (!released)
+                std::this_thread::yield();
+        }));
+
+        // `clear` keeps edit state while disposing slow callback
+        std::thread clearer{[&] { d.clear(); }};
+        while (!clearing)
+            std::this_thread::yield();
+
+        auto        inner = rpp::composite_disposable_wrapper::make();
+        std::thread waiter{[&] { d.add(inner); }};
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        released = true;
+
+        clearer.join();
+        waiter.join();
+
+        CHECK(!inner.is_disposed());
+        d.dispose();
+        CHECK(inner.is_disposed());
+    }
+
+    SUBCASE("concurrent add/remove keeps all not removed disposables")
+    {
+        auto d = rpp::composite_disposable_wrapper::make();
+
+        std::vector<std::vector<rpp::disposable_wrapper>> kept(threads_count);
+        run_in_parallel([&](size_t index) {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                auto inner = rpp::composite_disposable_wrapper::make();
+                d.add(inner);
+                if (i % 2 == 0)
+                    d.remove(inner);
+                else
+                    kept[index].push_back(inner);
+            }
+        });
+
+        d.dispose();
+        for (const auto& disposables : kept)
+        {
+            for (const auto& inner : disposables)
+                CHECK(inner.is_disposed());
+        }
+    }
+
+    SUBCASE("refcount disposes underlying exactly once after last concurrent release")
+    {
+        for (size_t i = 0; i < iterations / 10; ++i)
+        {
+            auto refcount   = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+            auto underlying = rpp::disposable_wrapper_impl<custom_disposable>::make();
+            refcount.add(underlying);
+
+            std::vector<rpp::composite_disposable_wrapper> refs{};
+            for (size_t j = 0; j < threads_count; ++j)
+                refs.push_back(refcount.lock()->add_ref());
+
+            run_in_parallel([&](size_t index) {
+                // extra short living refs concurrently with releasing of others
+                refcount.lock()->add_ref().dispose();
+                refs[index].dispose();
+            });
+
+            CHECK(refcount.is_disposed());
+            CHECK(underlying.lock()->dispose_count == 1);
+        }
+    }
+}
+
 TEST_CASE("static_disposable_container works as expected")
 {
     rpp::details::disposables::static_disposables_container<2> container{};
@@ -370,3 +623,127 @@ TEST_CASE("static_disposable_container works as expected")
         }
     }
 }
+
+TEST_CASE("small_disposables_container spills to heap after inline capacity")
+{
+    rpp::details::disposables::small_disposables_container<2> container{};
+
+    std::vector<rpp::composite_disposable_wrapper> disposables{};
+    for (size_t i = 0; i < 5; ++i)
+    {
+        disposables.push_back(rpp::composite_disposable_wrapper::make());
+        container.push_back(disposables.back());
+    }
+
+    SUBCASE("dispose disposes inline and spilled disposables")
+    {
+        container.dispose();
+        for (const auto& d : disposables)
+            CHECK(d.is_disposed());
+    }
+
+    SUBCASE("remove works for inline and spilled disposables")
+    {
+        container.remove(disposables[0]);
+        container.remove(disposables[3]);
+        container.dispose();
+
+        CHECK(!disposables[0].is_disposed());
+        CHECK(disposables[1].is_disposed());
+        CHECK(disposables[2].is_disposed());
+        CHECK(!disposables[3].is_disposed());
+        CHECK(disposables[4].is_disposed());
+    }
+
+    SUBCASE("clear removes everything")
+    {
+        container.clear();
+        container.dispose();
+        for (const auto& d : disposables)
+            CHECK(!d.is_disposed());
+    }
+
+    SUBCASE("move keeps everything")
+    {
+        auto other = std::move(container);
+        other.dispose();
+        for (const auto& d : disposables)
+            CHECK(d.is_disposed());
+    }
+}
+
+TEST_CASE("slots_disposables_container removes disposables by handles")
+{
+    rpp::details::disposables::slots_disposables_container container{};
+
+    std::vector<rpp::composite_disposable_wrapper>            disposables{};
+    std::vector<rpp::details::disposables::disposable_handle> handles{};
+    for (size_t i = 0; i < 3; ++i)
+    {
+        disposables.push_back(rpp::composite_disposable_wrapper::make());
+        handles.push_back(container.push_back_with_handle(disposables.back()));
+    }
+
+    SUBCASE("remove by handle removes only related disposable")
+    {
+        container.remove(handles[1]);
+        container.dispose();
+
+        CHECK(disposables[0].is_disposed());
+        CHECK(!disposables[1].is_disposed());
+        CHECK(disposables[2].is_disposed());
+    }
+
+    SUBCASE("stale handle doesn't remove disposable placed into same slot")
+    {
+        container.remove(handles[1]);
+
+        auto other = rpp::composite_disposable_wrapper::make();
+        container.push_back_with_handle(other);
+        container.remove(handles[1]);
+        container.dispose();
+
+        CHECK(other.is_disposed());
+    }
+
+    SUBCASE("handles obtained before clear are stale")
+    {
+        container.clear();
+
+        auto other = rpp::composite_disposable_wrapper::make();
+        container.push_back_with_handle(other);
+        for (const auto& handle : handles)
+            container.remove(handle);
+        container.dispose();
+
+        CHECK(other.is_disposed());
+        for (const auto& d : disposables)
+            CHECK(!d.is_disposed());
+    }
+
+    SUBCASE("default handle removes nothing")
+    {
+        container.remove(rpp::details::disposables::disposable_handle{});
+        container.dispose();
+
+        for (const auto& d : disposables)
+            CHECK(d.is_disposed());
+    }
+
+    SUBCASE("composite disposable removes by handle")
+    {
+        auto composite = rpp::disposable_wrapper_impl<rpp::details::slots_composite_disposable>::make();
+        auto inner     = rpp::composite_disposable_wrapper::make();
+
+        const auto handle = composite.add_with_handle(inner);
+        composite.remove(handle);
+        composite.dispose();
+        CHECK(!inner.is_disposed());
+
+        SUBCASE("adding to disposed composite disposes added one")
+        {
+            composite.add_with_handle(inner);
+            CHECK(inner.is_disposed());
+        }
+    }
+}
@@ -0,0 +1,150 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#include <doctest/doctest.h>
+
+#include <rpp/instrumentation.hpp>
+#include <rpp/observables/dynamic_observable.hpp>
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include <array>
+#include <chrono>
+
+using rpp::instrumentation::category;
+
+namespace
+{
+    size_t alive(category c)
+    {
+        return rpp::instrumentation::take_snapshot()[c].alive;
+    }
+} // namespace
+
+TEST_CASE("instrumentation counts alive objects")
+{
+    if constexpr (!rpp::instrumentation::is_enabled)
+    {
+        const auto d        = rpp::composite_disposable_wrapper::make();
+        const auto snapshot = rpp::instrumentation::take_snapshot();
+        for (const auto& counters : snapshot.values)
+        {
+            CHECK(counters.allocations == 0u);
+            CHECK(counters.reused == 0u);
+            CHECK(counters.alive == 0u);
+            CHECK(counters.alive_bytes == 0u);
+        }
+        return;
+    }
+
+    SUBCASE("disposables")
+    {
+        const auto before = rpp::instrumentation::take_snapshot()[category::disposables];
+        {
+            const auto d     = rpp::composite_disposable_wrapper::make();
+            const auto after = rpp::instrumentation::take_snapshot()[category::disposables];
+            CHECK(after.allocations == before.allocations + 1);
+            CHECK(after.alive == before.alive + 1);
+            CHECK(after.alive_bytes > before.alive_bytes);
+
+            SUBCASE("weak reference keeps memory")
+            {
+                const auto weak = d.as_weak();
+                d.dispose();
+            }
+        }
+        CHECK(alive(category::disposables) == before.alive);
+        CHECK(rpp::instrumentation::take_snapshot()[category::disposables].alive_bytes == before.alive_bytes);
+    }
+
+    SUBCASE("dynamic observers")
+    {
+        const auto before = rpp::instrumentation::take_snapshot()[category::dynamic_observers];
+        {
+            auto small = rpp::make_lambda_observer<int>([](int) {}).as_dynamic();
+            CHECK(alive(category::dynamic_observers) == before.alive + 1);
+            CHECK(rpp::instrumentation::take_snapshot()[category::dynamic_observers].allocations == before.allocations + 1);
+
+            auto big = rpp::make_lambda_observer<int>([padding = std::array<char, 256>{}](int v) { static_cast<void>(v + padding[0]); }).as_dynamic();
+            CHECK(alive(category::dynamic_observers) == before.alive + 2);
+            CHECK(rpp::instrumentation::take_snapshot()[category::dynamic_observers].allocations == before.allocations + 2);
+
+            const auto copy = big; // NOLINT
+            CHECK(alive(category::dynamic_observers) == before.alive + 2);
+        }
+        CHECK(alive(category::dynamic_observers) == before.alive);
+    }
+
+    SUBCASE("dynamic observable passes small observer without allocation")
+    {
+        const auto before = rpp::instrumentation::take_snapshot()[category::dynamic_observers];
+
+        rpp::source::create<int>([&](auto&& obs) {
+            CHECK(alive(category::dynamic_observers) == before.alive + 1);
+            obs.on_next(1);
+        })
+            .as_dynamic()
+            .subscribe([](int) {});
+        CHECK(alive(category::dynamic_observers) == before.alive);
+        CHECK(rpp::instrumentation::take_snapshot()[category::dynamic_observers].allocations == before.allocations);
+
+        rpp::source::create<int>([](rpp::dynamic_observer<int>&& obs) {
+            obs.on_next(1);
+        })
+            .as_dynamic()
+            .subscribe([](int) {});
+        CHECK(alive(category::dynamic_observers) == before.alive);
+        CHECK(rpp::instrumentation::take_snapshot()[category::dynamic_observers].allocations == before.allocations + 1);
+    }
+
+    SUBCASE("subject observers")
+    {
+        const auto before = alive(category::subject_observers);
+        {
+            rpp::subjects::publish_subject<int> subject{};
+            mock_observer_strategy<int>         mock{};
+
+            const auto d = subject.get_observable().subscribe_with_disposable(mock);
+            CHECK(alive(category::subject_observers) == before + 1);
+
+            d.dispose();
+            CHECK(alive(category::subject_observers) == before);
+
+            subject.get_observable().subscribe(mock);
+            CHECK(alive(category::subject_observers) == before + 1);
+        }
+        CHECK(alive(category::subject_observers) == before);
+    }
+
+    SUBCASE("schedulables")
+    {
+        const auto before   = rpp::instrumentation::take_snapshot()[category::schedulables];
+        const auto schedule = [] {
+            rpp::schedulers::run_loop loop{};
+            loop.create_worker().schedule(std::chrono::hours{1}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer<int>([](int) {}));
+            return rpp::instrumentation::take_snapshot()[category::schedulables];
+        };
+
+        const auto first = schedule();
+        CHECK(first.alive == before.alive + 1);
+        CHECK(first.alive_bytes > before.alive_bytes);
+        CHECK(first.allocations + first.reused == before.allocations + before.reused + 1);
+        CHECK(alive(category::schedulables) == before.alive);
+
+        SUBCASE("memory of destroyed schedulable is reused without heap allocation")
+        {
+            const auto second = schedule();
+            CHECK(second.allocations == first.allocations);
+            CHECK(second.reused == first.reused + 1);
+            CHECK(alive(category::schedulables) == before.alive);
+        }
+    }
+}
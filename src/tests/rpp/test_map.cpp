@@ -69,3 +69,51 @@ TEST_CASE("map satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::map([](auto&& v) { return std::forward<decltype(v)>(v); }));
 }
+
+TEST_CASE("chain of maps checks disposed state of final observer once per operator")
+{
+    struct counting_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        size_t& is_disposed_count;
+        size_t& on_next_count;
+
+        void on_next(const int&) const { ++on_next_count; }
+        void on_next(int&&) const { ++on_next_count; }
+        static void on_error(const std::exception_ptr&) {}
+        static void on_completed() {}
+        static void set_upstream(const rpp::disposable_wrapper&) {}
+
+        bool is_disposed() const
+        {
+            ++is_disposed_count;
+            return false;
+        }
+    };
+
+    size_t is_disposed_count{};
+    size_t on_next_count{};
+
+    const auto test = [&](const auto& observable, size_t operators_count) {
+        is_disposed_count = 0;
+        on_next_count     = 0;
+
+        observable.subscribe(rpp::observer<int, counting_strategy>{is_disposed_count, on_next_count});
+
+        CHECK(on_next_count == 3);
+        // per emission: source, each operator and final observer check state once, plus each operator checks it once during subscription. So cost per emission is linear over length of chain
+        CHECK(is_disposed_count <= (operators_count + 3) * (on_next_count + 1));
+    };
+
+    const auto inc = rpp::ops::map([](int v) { return v + 1; });
+
+    SUBCASE("1 map")
+    test(rpp::source::just(1, 2, 3) | inc, 1);
+
+    SUBCASE("10 maps")
+    test(rpp::source::just(1, 2, 3) | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc, 10);
+
+    SUBCASE("30 maps")
+    test(rpp::source::just(1, 2, 3) | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc | inc, 30);
+}
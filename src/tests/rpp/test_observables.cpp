@@ -23,8 +23,10 @@
 #include "rpp/operators/subscribe.hpp"
 #include "rpp/operators/take.hpp"
 
+#include <array>
 #include <chrono>
 #include <thread>
+#include <vector>
 
 TEST_CASE("create observable works properly as observable")
 {
@@ -105,6 +107,57 @@ TEST_CASE("create observable works properly as observable")
     }
 }
 
+TEST_CASE("dynamic_observable subscribes original observable after copies and moves")
+{
+    auto check = [](const auto& observable) {
+        mock_observer_strategy<int> mock{};
+        rpp::dynamic_observable<int> dynamic = observable.as_dynamic();
+
+        SUBCASE("copy")
+        {
+            auto copy = dynamic; // NOLINT
+            copy.subscribe(mock);
+            dynamic.subscribe(mock);
+            CHECK(mock.get_received_values() == std::vector{1, 1});
+        }
+
+        SUBCASE("move")
+        {
+            auto moved = std::move(dynamic);
+            moved.subscribe(mock);
+            CHECK(mock.get_received_values() == std::vector{1});
+        }
+
+        SUBCASE("assignment")
+        {
+            rpp::dynamic_observable<int> other = rpp::source::never<int>().as_dynamic();
+            other                              = dynamic;
+            other.subscribe(mock);
+
+            rpp::dynamic_observable<int> moved_to = rpp::source::never<int>().as_dynamic();
+            moved_to                              = std::move(other);
+            moved_to.subscribe(mock);
+            CHECK(mock.get_received_values() == std::vector{1, 1});
+        }
+
+        SUBCASE("dynamic of dynamic")
+        {
+            dynamic.as_dynamic().subscribe(mock);
+            CHECK(mock.get_received_values() == std::vector{1});
+        }
+    };
+
+    SUBCASE("small observable")
+    {
+        check(rpp::source::create<int>([](const auto& obs) { obs.on_next(1); }));
+    }
+
+    SUBCASE("big observable")
+    {
+        check(rpp::source::create<int>([padding = std::array<int, 64>{}](const auto& obs) { obs.on_next(1 + padding[0]); }));
+    }
+}
+
 TEST_CASE("blocking_observable blocks subscribe call")
 {
     mock_observer_strategy<int> mock{};
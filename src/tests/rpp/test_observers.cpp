@@ -14,7 +14,10 @@
 #include "rpp/disposables/fwd.hpp"
 #include "rpp_trompeloil.hpp"
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <thread>
 #include <vector>
 
 TEST_CASE("lambda observer works properly as base observer")
@@ -125,6 +128,83 @@ TEST_CASE("as_dynamic keeps disposing")
     }
 }
 
+TEST_CASE("dynamic_observer shares original observer between copies")
+{
+    auto check = [](auto&& observer, const std::vector<int>& values) {
+        auto dynamic = std::forward<decltype(observer)>(observer).as_dynamic();
+
+        SUBCASE("moved dynamic observer obtains callbacks")
+        {
+            auto moved = std::move(dynamic);
+            moved.on_next(1);
+            CHECK(values == std::vector{1});
+            moved.on_completed();
+            CHECK(moved.is_disposed());
+        }
+
+        SUBCASE("copy of copy obtains same callbacks and disposing")
+        {
+            auto copy         = dynamic;
+            auto copy_of_copy = copy; // NOLINT
+            dynamic.on_next(1);
+            copy_of_copy.on_next(2);
+            CHECK(values == std::vector{1, 2});
+            copy.on_completed();
+            CHECK(dynamic.is_disposed());
+            CHECK(copy_of_copy.is_disposed());
+        }
+
+        SUBCASE("assigned dynamic observer refers to new observer")
+        {
+            auto other = rpp::make_lambda_observer<int>([](int) {}).as_dynamic();
+            other      = dynamic;
+            other.on_next(1);
+            CHECK(values == std::vector{1});
+            other.on_completed();
+            CHECK(dynamic.is_disposed());
+
+            auto moved_to = rpp::make_lambda_observer<int>([](int) {}).as_dynamic();
+            moved_to      = std::move(other);
+            CHECK(moved_to.is_disposed());
+        }
+    };
+
+    std::vector<int> values{};
+
+    SUBCASE("small observer")
+    {
+        check(rpp::make_lambda_observer<int>([&values](int v) { values.push_back(v); }), values);
+    }
+
+    SUBCASE("big observer")
+    {
+        check(rpp::make_lambda_observer<int>([&values, padding = std::array<char, 256>{}](int v) { values.push_back(v + padding[0]); }), values);
+    }
+}
+
+TEST_CASE("dynamic_observer can be copied from different threads at the same time")
+{
+    std::atomic_size_t received{};
+    const auto         original = rpp::make_lambda_observer<int>([&received](int) { ++received; }).as_dynamic();
+
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&original] {
+            for (size_t j = 0; j < 1000; ++j)
+            {
+                const auto copy = original; // NOLINT
+                copy.on_next(1);
+            }
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    CHECK(received == 4000);
+    CHECK(!original.is_disposed());
+}
+
 TEST_CASE("observer disposes disposable on termination callbacks")
 {
     auto d        = rpp::composite_disposable_wrapper::make();
@@ -23,13 +23,18 @@
 #include "rpp/disposables/fwd.hpp"
 #include "rpp_trompeloil.hpp"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <ctime>
 #include <future>
+#include <numeric>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <vector>
 
 using namespace std::string_literals;
 
@@ -766,6 +771,30 @@ TEST_CASE("new_thread works till end")
     CHECK(!before);
 }
 
+TEST_CASE("new_thread doesn't burn CPU while waiting for delayed schedulable after worker is released")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::promise<void> executed{};
+    {
+        auto worker = rpp::schedulers::new_thread::create_worker();
+        worker.schedule(std::chrono::milliseconds{300}, [&executed](const auto&) {
+            executed.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+    }
+
+    [[maybe_unused]] const auto cpu_before = std::clock();
+    executed.get_future().get();
+    [[maybe_unused]] const auto cpu_after = std::clock();
+
+#if defined(__linux__)
+    // std::clock measures CPU time of process on linux: waiting thread should sleep, not spin
+    CHECK(static_cast<double>(cpu_after - cpu_before) / CLOCKS_PER_SEC < 0.1);
+#endif
+}
+
 TEST_CASE("run_loop scheduler dispatches tasks only manually")
 {
     auto scheduler = rpp::schedulers::run_loop{};
@@ -873,6 +902,198 @@ TEST_CASE("run_loop scheduler dispatches tasks only manually")
     }
 }
 
+TEST_CASE("run_loop scheduler dispatches ready schedulables in batches")
+{
+    auto scheduler = rpp::schedulers::run_loop{2};
+    auto worker    = scheduler.create_worker();
+    auto d         = rpp::composite_disposable_wrapper::make();
+    auto obs       = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+
+    std::vector<int> executions{};
+    for (int i = 0; i < 3; ++i)
+        worker.schedule([&executions, i](const auto&) -> rpp::schedulers::optional_delay_from_now {executions.push_back(i); return {}; }, obs);
+    worker.schedule(std::chrono::hours{1}, [&executions](const auto&) -> rpp::schedulers::optional_delay_from_now {executions.push_back(3); return {}; }, obs);
+
+    scheduler.dispatch_if_ready();
+    CHECK(executions == std::vector{0, 1});
+    CHECK(scheduler.is_any_ready_schedulable() == true);
+
+    scheduler.dispatch_if_ready();
+    CHECK(executions == std::vector{0, 1, 2});
+    CHECK(scheduler.is_any_ready_schedulable() == false);
+
+    SUBCASE("schedulable disposed by previous schedulable of the same batch is not executed")
+    {
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {executions.push_back(4); d.dispose(); return {}; }, obs);
+        worker.schedule([&executions](const auto&) -> rpp::schedulers::optional_delay_from_now {executions.push_back(5); return {}; }, obs);
+
+        scheduler.dispatch_if_ready();
+        CHECK(executions == std::vector{0, 1, 2, 4});
+    }
+}
+
+TEST_CASE("run_loop destroys compacted schedulables outside of its lock")
+{
+    auto scheduler = rpp::schedulers::run_loop{};
+    auto worker    = scheduler.create_worker();
+    auto d         = rpp::composite_disposable_wrapper::make();
+    auto dead_obs  = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+    auto alive_obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    size_t     executed{};
+    const auto increment = [&executed](const auto&) {
+        ++executed;
+        return rpp::schedulers::optional_delay_from_now{};
+    };
+
+    for (int i = 0; i < 100; ++i)
+    {
+        // destruction of disposed schedulable schedules to the same run_loop
+        std::shared_ptr<void> guard{nullptr, [&](void*) { worker.schedule(increment, alive_obs); }};
+        worker.schedule(std::chrono::hours{1}, [guard = std::move(guard)](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, dead_obs);
+    }
+    d.dispose();
+
+    // enough to trigger compaction of disposed schedulables
+    for (int i = 0; i < 200; ++i)
+        worker.schedule(increment, alive_obs);
+
+    while (scheduler.is_any_ready_schedulable())
+        scheduler.dispatch_if_ready();
+
+    CHECK(executed == 300);
+}
+
+TEST_CASE("new_thread executes schedulables in order with any batch size")
+{
+    for (const size_t max_batch_size : {size_t{1}, size_t{2}, rpp::schedulers::new_thread::s_default_max_batch_size})
+    {
+        std::vector<int> executions{};
+        std::atomic_bool done{};
+        {
+            auto worker = rpp::schedulers::new_thread::create_worker(max_batch_size);
+            auto obs    = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+            for (int i = 0; i < 100; ++i)
+            {
+                worker.schedule([&executions, &done, i](const auto&) {
+                    executions.push_back(i);
+                    if (i == 99)
+                        done = true;
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                obs);
+            }
+        }
+
+        while (!done)
+        {
+        };
+
+        std::vector<int> expected(100);
+        std::iota(expected.begin(), expected.end(), 0);
+        CHECK(executions == expected);
+    }
+}
+
+TEST_CASE("schedulers with spinning idle strategy")
+{
+    const auto idle = rpp::schedulers::idle_strategy{.spin_count = 1000, .yield_count = 10};
+    auto       obs  = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    SUBCASE("new_thread executes schedulables scheduled after idle period")
+    {
+        std::atomic_size_t executed{};
+        auto               worker = rpp::schedulers::configured_new_thread{idle}.create_worker();
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            worker.schedule([&executed](const auto&) {
+                ++executed;
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+
+            while (executed != i + 1)
+            {
+            };
+        }
+        CHECK(executed == 3);
+    }
+
+    SUBCASE("run_loop dispatches schedulable scheduled from other thread during dispatch")
+    {
+        auto   scheduler = rpp::schedulers::run_loop{idle};
+        size_t executed{};
+
+        auto t = std::thread{[&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            scheduler.create_worker().schedule([&executed](const auto&) {
+                ++executed;
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                                               obs);
+        }};
+        scheduler.dispatch();
+        t.join();
+
+        CHECK(executed == 1);
+    }
+}
+
+TEST_CASE("cached_now_scope caches now till end of scope or sleep")
+{
+    using namespace rpp::schedulers;
+
+    const auto before = details::now();
+    {
+        const details::cached_now_scope scope{};
+
+        const auto cached = details::now();
+        CHECK(cached >= before);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        CHECK(details::now() == cached);
+
+        SUBCASE("nested scope keeps caching")
+        {
+            {
+                const details::cached_now_scope nested{};
+                CHECK(details::now() > cached);
+            }
+            CHECK(details::now() > cached);
+        }
+        SUBCASE("sleep refreshes cached value")
+        {
+            details::sleep_for(std::chrono::milliseconds{1});
+            CHECK(details::now() > cached);
+        }
+        SUBCASE("refresh refreshes cached value")
+        {
+            details::cached_now_scope::refresh();
+            CHECK(details::now() > cached);
+        }
+        SUBCASE("advance_now_to refreshes cached value")
+        {
+            details::advance_now_to(cached + std::chrono::hours{1});
+            CHECK(details::now() > cached);
+        }
+    }
+
+    const auto first = details::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    CHECK(details::now() > first);
+}
+
+TEST_CASE("coarse_now is close to steady clock")
+{
+    const auto coarse = rpp::schedulers::details::coarse_now();
+    const auto now    = rpp::schedulers::clock_type::now();
+
+    CHECK(coarse <= now);
+    CHECK(now - coarse < std::chrono::milliseconds{100});
+}
+
 TEST_CASE("different delaying strategies")
 {
     rpp::schedulers::test_scheduler scheduler{};
@@ -1016,3 +1237,338 @@ TEST_CASE("thread_pool shares same thread")
 
     CHECK(f.get());
 }
+
+TEST_CASE("work_stealing_thread_pool executes ready workers on idle threads")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::work_stealing_thread_pool{2};
+
+    // thread_pool would place 1st and 3rd workers to the same thread
+    const auto first  = scheduler.create_worker();
+    const auto second = scheduler.create_worker();
+    const auto third  = scheduler.create_worker();
+
+    std::promise<void> third_executed{};
+    std::promise<bool> first_finished{};
+    first.schedule([&](const auto&) {
+        first_finished.set_value(third_executed.get_future().wait_for(std::chrono::seconds{5}) == std::future_status::ready);
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                   obs);
+    second.schedule([](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    third.schedule([&](const auto&) {
+        third_executed.set_value();
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                   obs);
+
+    CHECK(first_finished.get_future().get());
+}
+
+TEST_CASE("work_stealing_thread_pool keeps serial execution for worker")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::work_stealing_thread_pool{4};
+
+    std::vector<std::vector<int>> executions(4);
+    std::vector<std::atomic_int>  in_flight(4);
+    std::atomic_bool              concurrent_execution{};
+    std::atomic_size_t            done{};
+
+    {
+        std::vector<decltype(scheduler.create_worker())> workers{};
+        for (size_t i = 0; i < executions.size(); ++i)
+            workers.push_back(scheduler.create_worker());
+
+        for (int v = 0; v < 1000; ++v)
+        {
+            for (size_t i = 0; i < workers.size(); ++i)
+            {
+                workers[i].schedule([&, i, v](const auto&) {
+                    if (in_flight[i]++ != 0)
+                        concurrent_execution = true;
+                    executions[i].push_back(v);
+                    --in_flight[i];
+                    ++done;
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                    obs);
+            }
+        }
+    }
+
+    while (done.load() != 4000)
+        std::this_thread::yield();
+
+    CHECK(!concurrent_execution);
+
+    std::vector<int> expected(1000);
+    std::iota(expected.begin(), expected.end(), 0);
+    for (const auto& values : executions)
+        CHECK(values == expected);
+}
+
+TEST_CASE_TEMPLATE("thread pools apply thread options", TestType, rpp::schedulers::thread_pool, rpp::schedulers::work_stealing_thread_pool)
+{
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    auto scheduler = TestType{rpp::schedulers::thread_pool_options{.threads_count = 2, .name = "rpp_test", .affinity = {{0}}}};
+
+    std::promise<std::pair<std::string, int>> promise{};
+    scheduler.create_worker().schedule([&promise](const auto&) {
+        std::string name{};
+        int         cpu{};
+#if defined(__linux__)
+        std::array<char, 16> buffer{};
+        pthread_getname_np(pthread_self(), buffer.data(), buffer.size());
+        name = buffer.data();
+        cpu  = sched_getcpu();
+#endif
+        promise.set_value({name, cpu});
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                                       obs);
+
+    [[maybe_unused]] const auto [name, cpu] = promise.get_future().get();
+#if defined(__linux__)
+    CHECK(name.starts_with("rpp_test-"));
+    CHECK(cpu == 0);
+#endif
+}
+
+TEST_CASE_TEMPLATE("timer slack makes close timers share one wake-up", TestType, rpp::schedulers::thread_pool, rpp::schedulers::work_stealing_thread_pool)
+{
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    auto scheduler = TestType{rpp::schedulers::thread_pool_options{.threads_count = 1, .timer_slack = std::chrono::milliseconds{50}}};
+    auto worker    = scheduler.create_worker();
+
+    std::array<rpp::schedulers::time_point, 2> executed{};
+    std::atomic_size_t                         done{};
+
+    const auto start = rpp::schedulers::clock_type::now();
+    for (size_t i = 0; i < executed.size(); ++i)
+    {
+        worker.schedule(std::chrono::milliseconds{10 + 20 * i}, [&executed, &done, i](const auto&) {
+            executed[i] = rpp::schedulers::clock_type::now();
+            ++done;
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+    }
+
+    while (done != executed.size())
+        std::this_thread::yield();
+
+    // first timer waits for the second one instead of separate wake-up
+    CHECK(executed[0] >= start + std::chrono::milliseconds{30});
+    CHECK(executed[1] >= start + std::chrono::milliseconds{30});
+}
+
+TEST_CASE("thread_pool_options provides options for each thread")
+{
+    const auto options = rpp::schedulers::thread_pool_options{.threads_count = 3, .name = "pool", .affinity = {{0, 1}, {2}}};
+
+    CHECK(options.get_thread_options(0).name == "pool-0");
+    CHECK(options.get_thread_options(0).cpus == std::vector<size_t>{0, 1});
+    CHECK(options.get_thread_options(1).cpus == std::vector<size_t>{2});
+    CHECK(options.get_thread_options(2).name == "pool-2");
+    CHECK(options.get_thread_options(2).cpus == std::vector<size_t>{0, 1});
+
+    const auto empty = rpp::schedulers::thread_pool_options{}.get_thread_options(0);
+    CHECK(empty.name.empty());
+    CHECK(empty.cpus.empty());
+}
+
+TEST_CASE("computational can't be configured after first usage")
+{
+    static_cast<void>(rpp::schedulers::computational::create_worker());
+    CHECK(!rpp::schedulers::computational::configure(rpp::schedulers::thread_pool_options{.threads_count = 1}));
+}
+TEST_CASE_TEMPLATE("schedulables_queue keeps order of time_points and FIFO for equal time_points", TestType, rpp::schedulers::details::binary_heap_schedulables_storage, rpp::schedulers::details::quaternary_heap_schedulables_storage, rpp::schedulers::details::default_schedulables_storage)
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy, TestType> queue{};
+    std::vector<int>                                                                                         executions{};
+
+    const auto schedule = [&](rpp::schedulers::time_point tp, int id) {
+        queue.emplace(tp, [&executions, id](const auto&) {
+            executions.push_back(id);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                      obs);
+    };
+
+    const auto drain = [&] {
+        while (!queue.is_empty())
+            (*queue.pop())();
+    };
+
+    const auto base = rpp::schedulers::time_point{std::chrono::seconds{10}};
+
+    SUBCASE("schedulables with same time_point executed in order of scheduling")
+    {
+        for (int i = 0; i < 100; ++i)
+            schedule(base, i);
+
+        CHECK(queue.size() == 100);
+        drain();
+
+        std::vector<int> expected(100);
+        std::iota(expected.begin(), expected.end(), 0);
+        CHECK(executions == expected);
+    }
+
+    SUBCASE("schedulables with different time_points executed in order of time_points")
+    {
+        schedule(base + std::chrono::seconds{3}, 3);
+        schedule(base + std::chrono::seconds{1}, 1);
+        schedule(base + std::chrono::seconds{4}, 4);
+        schedule(base + std::chrono::seconds{1}, 11);
+        schedule(base + std::chrono::seconds{2}, 2);
+        schedule(base + std::chrono::seconds{5}, 5);
+        schedule(base + std::chrono::seconds{0}, 0);
+        schedule(base + std::chrono::seconds{3}, 33);
+
+        drain();
+        CHECK(executions == std::vector{0, 1, 11, 2, 3, 33, 4, 5});
+    }
+
+    SUBCASE("re-emplaced schedulable placed after schedulables with same time_point")
+    {
+        schedule(base, 0);
+        schedule(base, 1);
+
+        auto top = queue.pop();
+        queue.emplace(base, std::move(top));
+
+        drain();
+        CHECK(executions == std::vector{1, 0});
+    }
+
+    SUBCASE("a lot of pseudo-random time_points executed in sorted order")
+    {
+        std::vector<int> expected{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            const int offset = (i * 7919) % 127;
+            schedule(base + std::chrono::milliseconds{offset}, offset);
+            expected.push_back(offset);
+        }
+        std::stable_sort(expected.begin(), expected.end());
+
+        drain();
+        CHECK(executions == expected);
+    }
+}
+
+TEST_CASE_TEMPLATE("schedulables_queue removes disposed schedulables", TestType, rpp::schedulers::details::binary_heap_schedulables_storage, rpp::schedulers::details::quaternary_heap_schedulables_storage, rpp::schedulers::details::default_schedulables_storage)
+{
+    auto alive_obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    auto d         = rpp::composite_disposable_wrapper::make();
+    auto dead_obs  = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+    auto counter   = std::make_shared<int>();
+
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy, TestType> queue{};
+    std::vector<int>                                                                                         executions{};
+
+    const auto schedule = [&](rpp::schedulers::time_point tp, int id, const auto& obs) {
+        queue.emplace(tp, [&executions, id, counter](const auto&) {
+            static_cast<void>(counter);
+            executions.push_back(id);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                      obs);
+    };
+
+    const auto base = rpp::schedulers::time_point{std::chrono::seconds{10}};
+
+    SUBCASE("compact removes only disposed schedulables and keeps order of others")
+    {
+        std::vector<int> expected{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            const int offset = (i * 7919) % 127;
+            if (i % 10 == 0)
+            {
+                schedule(base + std::chrono::milliseconds{offset}, offset, alive_obs);
+                expected.push_back(offset);
+            }
+            else
+            {
+                schedule(base + std::chrono::milliseconds{offset}, offset, dead_obs);
+            }
+        }
+        std::stable_sort(expected.begin(), expected.end());
+
+        CHECK(queue.get_disposed_count() == 0);
+        d.dispose();
+        CHECK(queue.get_disposed_count() == 900);
+
+        auto compacted = queue.compact();
+        CHECK(compacted.size() == 900);
+        CHECK(queue.size() == 100);
+        CHECK(queue.get_disposed_count() == 0);
+        CHECK(queue.get_compacted_count() == 900);
+        // removed schedulables are destroyed by caller
+        CHECK(counter.use_count() == 1001);
+        compacted.clear();
+        CHECK(counter.use_count() == 101);
+
+        while (!queue.is_empty())
+            (*queue.pop())();
+        CHECK(executions == expected);
+    }
+
+    SUBCASE("disposed schedulables don't pile up while new schedulables arrive")
+    {
+        d.dispose();
+        schedule(base, -1, alive_obs);
+        for (int i = 0; i < 10'000; ++i)
+            schedule(base + std::chrono::milliseconds{i}, i, dead_obs);
+
+        CHECK(queue.size() <= 128);
+        CHECK(queue.get_compacted_count() >= 10'000 - 128);
+        CHECK(counter.use_count() == static_cast<long>(queue.size()) + 1);
+
+        queue.compact();
+        CHECK(queue.size() == 1);
+        CHECK(queue.get_compacted_count() == 10'000);
+    }
+}
+
+TEST_CASE("schedulables_queue destroys schedulables")
+{
+    auto obs     = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    auto counter = std::make_shared<int>();
+
+    const auto test = [&](const auto& payload) {
+        {
+            rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{};
+            for (int i = 0; i < 10; ++i)
+            {
+                queue.emplace(rpp::schedulers::time_point{std::chrono::seconds{i}}, [counter, payload](const auto&) {
+                    static_cast<void>(counter);
+                    static_cast<void>(payload);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                              obs);
+            }
+            CHECK(counter.use_count() == 11);
+
+            queue.pop();
+            CHECK(counter.use_count() == 10);
+        }
+        CHECK(counter.use_count() == 1);
+    };
+
+    SUBCASE("small schedulables allocated from pool")
+    {
+        test(int{});
+    }
+    SUBCASE("big schedulables allocated from global heap")
+    {
+        test(std::array<char, 1024>{});
+    }
+}
@@ -13,10 +13,15 @@
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/observers/mock_observer.hpp>
 #include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/subscribe.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/thread_pool.hpp>
 #include <rpp/sources/create.hpp>
 #include <rpp/subjects/behavior_subject.hpp>
 #include <rpp/subjects/publish_subject.hpp>
 #include <rpp/subjects/replay_subject.hpp>
+#include <rpp/subjects/sharded_publish_subject.hpp>
 
 #include "copy_count_tracker.hpp"
 #include "rpp_trompeloil.hpp"
@@ -167,6 +172,119 @@ TEST_CASE("subject can be modified from on_next call")
         subject.get_observer().on_next(1);
         subject.get_observer().on_next(2);
     }
+
+    SUBCASE("subscribe a lot of observers inside on_next")
+    {
+        auto inner = mock_observer_strategy<int>{};
+
+        subject.get_observable() | rpp::ops::take(1) | rpp::ops::subscribe([&subject, &inner](int) {
+            for (size_t i = 0; i < 100; ++i)
+                subject.get_observable().subscribe(inner);
+        });
+
+        subject.get_observer().on_next(1);
+        CHECK(inner.get_received_values().empty());
+
+        subject.get_observer().on_next(2);
+        CHECK(inner.get_received_values() == std::vector<int>(100, 2));
+    }
+}
+
+TEST_CASE("publish subject unsubscribes observers in any order")
+{
+    rpp::subjects::publish_subject<int>            subject{};
+    std::vector<mock_observer_strategy<int>>       mocks{};
+    std::vector<rpp::composite_disposable_wrapper> disposables{};
+    for (size_t i = 0; i < 100; ++i)
+    {
+        mocks.emplace_back();
+        disposables.push_back(rpp::composite_disposable_wrapper::make());
+        subject.get_observable().subscribe(disposables.back(), mocks.back());
+    }
+
+    const auto check_received = [&](int value, auto&& is_subscribed) {
+        for (size_t i = 0; i < mocks.size(); ++i)
+        {
+            const auto& values = mocks[i].get_received_values();
+            CHECK((is_subscribed(i) ? !values.empty() && values.back() == value : values.empty() || values.back() != value));
+        }
+    };
+
+    SUBCASE("dispose every second observer, then the rest of them in reverse order")
+    {
+        for (size_t i = 0; i < disposables.size(); i += 2)
+            disposables[i].dispose();
+
+        subject.get_observer().on_next(1);
+        check_received(1, [](size_t i) { return i % 2 == 1; });
+
+        for (size_t i = disposables.size() - 1; i > 50; i -= 2)
+            disposables[i].dispose();
+
+        subject.get_observer().on_next(2);
+        check_received(2, [](size_t i) { return i % 2 == 1 && i < 50; });
+
+        for (const auto& d : disposables)
+            d.dispose();
+
+        subject.get_observer().on_next(3);
+        check_received(3, [](size_t) { return false; });
+
+        SUBCASE("subscribe again after all observers unsubscribed")
+        {
+            auto mock = mock_observer_strategy<int>{};
+            subject.get_observable().subscribe(mock);
+            subject.get_observer().on_next(4);
+            CHECK(mock.get_received_values() == std::vector{4});
+        }
+    }
+
+    SUBCASE("unsubscribe observer and emit recursively from on_next")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        auto d    = rpp::composite_disposable_wrapper::make();
+
+        subject.get_observable() | rpp::ops::take(1) | rpp::ops::subscribe([&](int) {
+            d.clear();
+            subject.get_observer().on_next(2);
+        });
+        subject.get_observable().subscribe(d, mock);
+
+        subject.get_observer().on_next(1);
+        subject.get_observer().on_next(3);
+
+        // unsubscribed during emission of 1, so it still obtains it, but not any of next values
+        CHECK(mock.get_received_values() == std::vector{1});
+    }
+}
+
+TEST_CASE("publish subject handles subscriptions concurrently with on_next")
+{
+    rpp::subjects::publish_subject<int> subject{};
+    auto                                mock = mock_observer_strategy<int>{};
+    subject.get_observable().subscribe(mock);
+
+    std::atomic_bool stop{};
+    std::thread      churn{[&] {
+        while (!stop.load())
+        {
+            auto d = rpp::composite_disposable_wrapper::make();
+            for (size_t i = 0; i < 10; ++i)
+                subject.get_observable().subscribe(d, [](int) {});
+            d.dispose();
+        }
+    }};
+
+    std::vector<int> expected{};
+    for (int i = 0; i < 10000; ++i)
+    {
+        subject.get_observer().on_next(i);
+        expected.push_back(i);
+    }
+    stop.store(true);
+    churn.join();
+
+    CHECK(mock.get_received_values() == expected);
 }
 
 TEST_CASE("publish subject caches error/completed")
@@ -265,6 +383,99 @@ TEST_CASE("publish subject caches error/completed")
     }
 }
 
+TEST_CASE_TEMPLATE("sharded publish subject multicasts values", TestType, rpp::subjects::sharded_publish_subject<int, rpp::schedulers::immediate>, rpp::subjects::serialized_sharded_publish_subject<int, rpp::schedulers::immediate>)
+{
+    auto subj = TestType{rpp::schedulers::immediate{}, 3};
+
+    std::vector<mock_observer_strategy<int>> mocks{};
+    for (size_t i = 0; i < 5; ++i)
+        subj.get_observable().subscribe(mocks.emplace_back());
+
+    subj.get_observer().on_next(1);
+    subj.get_observer().on_next(2);
+
+    SUBCASE("each observer obtains all values")
+    {
+        for (const auto& mock : mocks)
+            CHECK(mock.get_received_values() == std::vector{1, 2});
+    }
+
+    SUBCASE("each observer obtains completion after values")
+    {
+        subj.get_observer().on_completed();
+        subj.get_observer().on_next(3);
+
+        for (const auto& mock : mocks)
+        {
+            CHECK(mock.get_received_values() == std::vector{1, 2});
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+
+        SUBCASE("observer subscribed after completion obtains completion")
+        {
+            auto mock = mock_observer_strategy<int>{};
+            subj.get_observable().subscribe(mock);
+            CHECK(mock.get_total_on_next_count() == 0);
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+    }
+
+    SUBCASE("each observer obtains error after values")
+    {
+        subj.get_observer().on_error({});
+
+        for (const auto& mock : mocks)
+        {
+            CHECK(mock.get_received_values() == std::vector{1, 2});
+            CHECK(mock.get_on_error_count() == 1);
+        }
+    }
+
+    SUBCASE("observers don't obtain values after dispose of subject")
+    {
+        subj.get_disposable().dispose();
+        subj.get_observer().on_next(3);
+
+        for (const auto& mock : mocks)
+        {
+            CHECK(mock.get_received_values() == std::vector{1, 2});
+            CHECK(mock.get_on_completed_count() == 0);
+        }
+    }
+}
+
+TEST_CASE("sharded publish subject keeps order of values for each observer")
+{
+    constexpr size_t observers_count = 100;
+    constexpr int    values_count    = 1000;
+
+    auto subj = rpp::subjects::sharded_publish_subject<int, rpp::schedulers::thread_pool>{rpp::schedulers::thread_pool{4}, 4};
+
+    std::vector<mock_observer_strategy<int>> mocks{};
+    std::atomic<size_t>                      completed{};
+    for (size_t i = 0; i < observers_count; ++i)
+    {
+        const auto& mock = mocks.emplace_back();
+        subj.get_observable().subscribe([mock](int v) { mock.on_next(v); },
+                                        [](const std::exception_ptr&) {},
+                                        [&completed]() { completed.fetch_add(1); });
+    }
+
+    std::vector<int> expected{};
+    for (int i = 0; i < values_count; ++i)
+    {
+        subj.get_observer().on_next(i);
+        expected.push_back(i);
+    }
+    subj.get_observer().on_completed();
+
+    while (completed.load() != observers_count)
+        std::this_thread::yield();
+
+    for (const auto& mock : mocks)
+        CHECK(mock.get_received_values() == expected);
+}
+
 TEST_CASE_TEMPLATE("serialized subjects handles race condition", TestType, rpp::subjects::serialized_publish_subject<int>, rpp::subjects::serialized_replay_subject<int>, rpp::subjects::serialized_behavior_subject<int>)
 {
     auto subj = []() {
@@ -388,6 +599,50 @@ TEST_CASE_TEMPLATE("replay subject multicasts values and replay", TestType, rpp:
         }
     }
 
+    SUBCASE("bounded replay subject with a lot of values")
+    {
+        auto mock_1 = mock_observer_strategy<int>{};
+
+        size_t bound = 100;
+        auto   sub   = TestType{bound};
+
+        std::vector<int> expected{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            sub.get_observer().on_next(i);
+            if (i >= 900)
+                expected.push_back(i);
+        }
+
+        sub.get_observable().subscribe(mock_1.get_observer());
+
+        SUBCASE("observer obtains only latest values")
+        {
+            CHECK(mock_1.get_received_values() == expected);
+        }
+
+        SUBCASE("observer emitting new values during replay obtains values at the moment of subscription")
+        {
+            auto mock_2 = mock_observer_strategy<int>{};
+
+            std::vector<int> replayed{};
+            sub.get_observable().subscribe([&](int v) {
+                replayed.push_back(v);
+                if (v < 1000)
+                    sub.get_observer().on_next(v + 1000);
+            });
+
+            CHECK(replayed == expected);
+
+            sub.get_observable().subscribe(mock_2.get_observer());
+
+            std::vector<int> expected_after{};
+            for (int i = 1900; i < 2000; ++i)
+                expected_after.push_back(i);
+            CHECK(mock_2.get_received_values() == expected_after);
+        }
+    }
+
     SUBCASE("bounded replay subject with duration")
     {
         using namespace std::chrono_literals;
@@ -444,8 +699,8 @@ TEST_CASE_TEMPLATE("replay subject doesn't introduce additional copies", TestTyp
         sub.get_observer().on_next(copy_count_tracker{});
 
         sub.get_observable().subscribe([](copy_count_tracker tracker) { // NOLINT
-            CHECK(tracker.get_copy_count() == 2 + 1);                   // + 1 copy values from buffer for this observer
-            CHECK(tracker.get_move_count() == 0 + 1);                   // + 1 move to this observer
+            CHECK(tracker.get_copy_count() == 2 + 1);                   // + 1 copy directly from buffer to this observer
+            CHECK(tracker.get_move_count() == 0);
         });
     }
 
@@ -462,8 +717,8 @@ TEST_CASE_TEMPLATE("replay subject doesn't introduce additional copies", TestTyp
         sub.get_observer().on_next(tracker);
 
         sub.get_observable().subscribe([](copy_count_tracker tracker) { // NOLINT
-            CHECK(tracker.get_copy_count() == 2 + 1);                   // + 1 copy values from buffer for this observer
-            CHECK(tracker.get_move_count() == 0 + 1);                   // + 1 move to this observer
+            CHECK(tracker.get_copy_count() == 2 + 1);                   // + 1 copy directly from buffer to this observer
+            CHECK(tracker.get_move_count() == 0);
         });
     }
 }